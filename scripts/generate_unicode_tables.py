@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+"""Generates the compact Unicode property tables used by ofxMixedFont.
+
+Usage: python3 scripts/generate_unicode_tables.py [output_dir] [ucd_dir]
+
+The tables are derived from the unicodedata module of the running Python
+(see UNICODE_VERSION in the generated headers), and from UCD files of the
+same version (LineBreak.txt, BidiMirroring.txt), which are read from ucd_dir or
+downloaded from unicode.org. Property values are written as two-stage
+lookup tables: stage1[code_point >> SHIFT] selects a deduplicated block in
+stage2, and stage2[block * BLOCK_SIZE + (code_point & MASK)] is the value.
+"""
+
+import os
+import sys
+import unicodedata
+import urllib.request
+
+UCD_URL = 'https://www.unicode.org/Public/%s/ucd/%s'
+MAX_CODE_POINT = 0x110000
+SHIFT = 7
+BLOCK_SIZE = 1 << SHIFT
+
+# Note: Keep the order in sync with ofxLineBreakClass in ofxMixedFontLineBreak.hpp
+LINE_BREAK_CLASSES = [
+    'XX', 'BK', 'CR', 'LF', 'NL', 'SP', 'ZW', 'WJ', 'GL', 'CM', 'ZWJ',
+    'OP', 'CL', 'CP', 'QU', 'NS', 'EX', 'SY', 'IS', 'PR', 'PO', 'NU',
+    'AL', 'HL', 'ID', 'IN', 'HY', 'BA', 'BB', 'B2', 'CJ', 'RI', 'EB',
+    'EM', 'H2', 'H3', 'JL', 'JV', 'JT', 'SA', 'CB', 'AI', 'SG',
+]
+LINE_BREAK_EAST_ASIAN_FLAG = 0x40  # Note: East_Asian_Width F, W or H (LB30)
+LINE_BREAK_RESERVED_PICTOGRAPHIC_FLAG = 0x80  # Note: unassigned Extended_Pictographic (LB30b)
+
+
+# Note: Keep the order in sync with ofxBidiClass in ofxMixedFontBidi.hpp
+BIDI_CLASSES = [
+    'L', 'R', 'AL', 'EN', 'ES', 'ET', 'AN', 'CS', 'NSM', 'BN', 'B', 'S', 'WS', 'ON',
+    'LRE', 'LRO', 'RLE', 'RLO', 'PDF', 'LRI', 'RLI', 'FSI', 'PDI',
+]
+
+# Note: Default Bidi_Class values of unassigned code points (DerivedBidiClass.txt)
+BIDI_DEFAULT_RANGES = [
+    ((0x0590, 0x05FF), 'R'), ((0x0600, 0x07BF), 'AL'), ((0x07C0, 0x085F), 'R'), ((0x0860, 0x08FF), 'AL'),
+    ((0x20A0, 0x20CF), 'ET'), ((0xFB1D, 0xFB4F), 'R'), ((0xFB50, 0xFDCF), 'AL'), ((0xFDF0, 0xFDFF), 'AL'),
+    ((0xFE70, 0xFEFF), 'AL'), ((0x10800, 0x10CFF), 'R'), ((0x10D00, 0x10D3F), 'AL'), ((0x10D40, 0x10EBF), 'R'),
+    ((0x10EC0, 0x10EFF), 'AL'), ((0x10F00, 0x10F2F), 'R'), ((0x10F30, 0x10F6F), 'AL'), ((0x10F70, 0x10FFF), 'R'),
+    ((0x1E800, 0x1EC6F), 'R'), ((0x1EC70, 0x1ECBF), 'AL'), ((0x1ECC0, 0x1ECFF), 'R'), ((0x1ED00, 0x1ED4F), 'AL'),
+    ((0x1ED50, 0x1EDFF), 'R'), ((0x1EE00, 0x1EEFF), 'AL'), ((0x1EF00, 0x1EFFF), 'R'),
+]
+
+
+def ranges(*items):
+    for item in items:
+        if isinstance(item, tuple):
+            for cp in range(item[0], item[1] + 1):
+                yield cp
+        else:
+            yield item
+
+
+def read_ucd_file(ucd_dir, name):
+    if ucd_dir:
+        with open(os.path.join(ucd_dir, name), encoding='utf-8') as f:
+            return f.read()
+    with urllib.request.urlopen(UCD_URL % (unicodedata.unidata_version, name)) as response:
+        return response.read().decode('utf-8')
+
+
+def parse_ucd_fields(text):
+    for line in text.splitlines():
+        line = line.split('#', 1)[0].strip()
+        if line:
+            yield [field.strip() for field in line.split(';')]
+
+
+def in_ranges(cp, range_list):
+    return any(begin <= cp <= end for begin, end in range_list)
+
+
+def line_break_classes(ucd_dir):
+    values = ['XX'] * MAX_CODE_POINT
+    for line in read_ucd_file(ucd_dir, 'LineBreak.txt').splitlines():
+        # Note: "# @missing:" lines give the default of the code points which are not listed after them
+        if line.startswith('# @missing:'):
+            line = line[len('# @missing:'):]
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+        code_points, value = [field.strip() for field in line.split(';')]
+        begin, _, end = code_points.partition('..')
+        for cp in range(int(begin, 16), int(end or begin, 16) + 1):
+            values[cp] = value
+
+    # Note: LB1 resolves SA to CM for Mn and Mc. It is done here, since the general category isn't available at runtime.
+    for cp in range(MAX_CODE_POINT):
+        if values[cp] == 'SA' and unicodedata.category(chr(cp)) in ('Mn', 'Mc'):
+            values[cp] = 'CM'
+    return values
+
+
+def bidi_mirroring_glyphs(ucd_dir):
+    pairs = []
+    for fields in parse_ucd_fields(read_ucd_file(ucd_dir, 'BidiMirroring.txt')):
+        pairs.append((int(fields[0], 16), int(fields[1], 16)))
+    return sorted(pairs)
+
+
+def bidi_class(cp):
+    ch = chr(cp)
+    value = unicodedata.bidirectional(ch)
+    if value:
+        return value
+
+    for (begin, end), default in BIDI_DEFAULT_RANGES:
+        if begin <= cp <= end:
+            return default
+    if (cp & 0xFFFE) == 0xFFFE or 0xFDD0 <= cp <= 0xFDEF or 0xE0000 <= cp <= 0xE0FFF:
+        return 'BN'
+    return 'L'
+
+
+# Note: Keep the order in sync with ofxGraphemeClusterBreak in ofxMixedFontGraphemeBreak.hpp
+GRAPHEME_CLUSTER_BREAKS = [
+    'Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend', 'SpacingMark',
+    'L', 'V', 'T', 'LV', 'LVT',
+]
+EXTENDED_PICTOGRAPHIC_FLAG = 0x10
+
+GRAPHEME_CLUSTER_BREAK_OVERRIDES = {
+    'CR': ranges(0x000D),
+    'LF': ranges(0x000A),
+    'ZWJ': ranges(0x200D),
+    'Regional_Indicator': ranges((0x1F1E6, 0x1F1FF)),
+    # Note: Other_Grapheme_Extend and emoji modifiers
+    'Extend': ranges(0x09BE, 0x09D7, 0x0B3E, 0x0B57, 0x0BBE, 0x0BD7, 0x0CC2, 0x0CD5, 0x0CD6, 0x0D3E, 0x0D57, 0x0DCF,
+                     0x0DDF, 0x1B35, 0x200C, 0x302E, 0x302F, 0xFF9E, 0xFF9F, 0x1133E, 0x11357, 0x114B0, 0x114BD, 0x115AF,
+                     0x11930, 0x1D165, (0x1D16E, 0x1D172), (0xE0020, 0xE007F), (0x1F3FB, 0x1F3FF)),
+    'Prepend': ranges((0x0600, 0x0605), 0x06DD, 0x070F, 0x0890, 0x0891, 0x08E2, 0x0D4E, 0x110BD, 0x110CD, 0x111C2,
+                      0x111C3, 0x1193F, 0x11941, 0x11A3A, (0x11A84, 0x11A89), 0x11D46),
+    'SpacingMark': ranges(0x0E33, 0x0EB3),
+    # Note: Spacing combining marks which are not SpacingMark
+    'Other': ranges(0x102B, 0x102C, 0x1038, (0x1062, 0x1064), (0x1067, 0x106D), 0x1083, (0x1087, 0x108C), 0x108F,
+                    (0x109A, 0x109C), 0x1A61, 0x1A63, 0x1A64, 0xAA7B, 0xAA7D, 0x11720, 0x11721),
+    'L': ranges((0x1100, 0x115F), (0xA960, 0xA97C)),
+    'V': ranges((0x1160, 0x11A7), (0xD7B0, 0xD7C6)),
+    'T': ranges((0x11A8, 0x11FF), (0xD7CB, 0xD7FB)),
+}
+
+EXTENDED_PICTOGRAPHIC_RANGES = [
+    (0x00A9, 0x00A9), (0x00AE, 0x00AE), (0x203C, 0x203C), (0x2049, 0x2049), (0x2122, 0x2122), (0x2139, 0x2139),
+    (0x2194, 0x2199), (0x21A9, 0x21AA), (0x231A, 0x231B), (0x2328, 0x2328), (0x2388, 0x2388), (0x23CF, 0x23CF),
+    (0x23E9, 0x23F3), (0x23F8, 0x23FA), (0x24C2, 0x24C2), (0x25AA, 0x25AB), (0x25B6, 0x25B6), (0x25C0, 0x25C0),
+    (0x25FB, 0x25FE), (0x2600, 0x2605), (0x2607, 0x2612), (0x2614, 0x2685), (0x2690, 0x2705), (0x2708, 0x2712),
+    (0x2714, 0x2714), (0x2716, 0x2716), (0x271D, 0x271D), (0x2721, 0x2721), (0x2728, 0x2728), (0x2733, 0x2734),
+    (0x2744, 0x2744), (0x2747, 0x2747), (0x274C, 0x274C), (0x274E, 0x274E), (0x2753, 0x2755), (0x2757, 0x2757),
+    (0x2763, 0x2767), (0x2795, 0x2797), (0x27A1, 0x27A1), (0x27B0, 0x27B0), (0x27BF, 0x27BF), (0x2934, 0x2935),
+    (0x2B05, 0x2B07), (0x2B1B, 0x2B1C), (0x2B50, 0x2B50), (0x2B55, 0x2B55), (0x3030, 0x3030), (0x303D, 0x303D),
+    (0x3297, 0x3297), (0x3299, 0x3299), (0x1F000, 0x1F0FF), (0x1F10D, 0x1F10F), (0x1F12F, 0x1F12F),
+    (0x1F16C, 0x1F171), (0x1F17E, 0x1F17F), (0x1F18E, 0x1F18E), (0x1F191, 0x1F19A), (0x1F1AD, 0x1F1E5),
+    (0x1F201, 0x1F20F), (0x1F21A, 0x1F21A), (0x1F22F, 0x1F22F), (0x1F232, 0x1F23A), (0x1F23C, 0x1F23F),
+    (0x1F249, 0x1F3FA), (0x1F400, 0x1F53D), (0x1F546, 0x1F64F), (0x1F680, 0x1F6FF), (0x1F774, 0x1F77F),
+    (0x1F7D5, 0x1F7FF), (0x1F80C, 0x1F80F), (0x1F848, 0x1F84F), (0x1F85A, 0x1F85F), (0x1F888, 0x1F88F),
+    (0x1F8AE, 0x1F8FF), (0x1F90C, 0x1F93A), (0x1F93C, 0x1F945), (0x1F947, 0x1FAFF), (0x1FC00, 0x1FFFD),
+]
+
+
+def grapheme_cluster_break(cp, overrides):
+    if cp in overrides:
+        return overrides[cp]
+
+    if 0xAC00 <= cp <= 0xD7A3:
+        return 'LV' if (cp - 0xAC00) % 28 == 0 else 'LVT'
+
+    category = unicodedata.category(chr(cp))
+    if category in ('Mn', 'Me'):
+        return 'Extend'
+    if category == 'Mc':
+        return 'SpacingMark'
+    if category in ('Cc', 'Cf', 'Zl', 'Zp', 'Cs'):
+        return 'Control'
+    if category == 'Cn' and 0xE0000 <= cp <= 0xE0FFF:
+        return 'Control'
+    return 'Other'
+
+
+def make_two_stage_table(values):
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for begin in range(0, len(values), BLOCK_SIZE):
+        block = tuple(values[begin:begin + BLOCK_SIZE])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+def format_array(ctype, name, values, per_line=32):
+    lines = ['static const %s %s[%d] = {' % (ctype, name, len(values))]
+    for begin in range(0, len(values), per_line):
+        lines.append('    ' + ','.join(str(v) for v in values[begin:begin + per_line]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def format_pair_array(name, pairs, per_line=8):
+    lines = ['static const char32_t %s[%d][2] = {' % (name, len(pairs))]
+    for begin in range(0, len(pairs), per_line):
+        lines.append('    ' + ','.join('{0x%04X,0x%04X}' % pair for pair in pairs[begin:begin + per_line]) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def write_table_header(path, prefix, stage1, stage2, extra_tables=()):
+    stage1_type = 'unsigned char' if max(stage1) < 256 else 'unsigned short'
+    with open(path, 'w') as f:
+        f.write('#pragma once\n\n')
+        f.write('// Note: Generated by scripts/generate_unicode_tables.py. Do not edit.\n')
+        f.write('//       UNICODE_VERSION %s\n\n' % unicodedata.unidata_version)
+        f.write('namespace ofxMixedFontUtil {\n\n')
+        f.write('static const int %s_SHIFT = %d;\n' % (prefix, SHIFT))
+        f.write('static const int %s_MASK = %d;\n' % (prefix, BLOCK_SIZE - 1))
+        f.write('static const char32_t %s_MAX_CODE_POINT = 0x%X;\n\n' % (prefix, MAX_CODE_POINT - 1))
+        f.write(format_array(stage1_type, prefix + '_STAGE1', stage1) + '\n\n')
+        f.write(format_array('unsigned char', prefix + '_STAGE2', stage2) + '\n\n')
+        for table in extra_tables:
+            f.write(table + '\n\n')
+        f.write('}\n')
+
+
+def generate_line_break_table(output_dir, ucd_dir):
+    values = []
+    for cp, line_break_class in enumerate(line_break_classes(ucd_dir)):
+        value = LINE_BREAK_CLASSES.index(line_break_class)
+        ch = chr(cp)
+        if unicodedata.east_asian_width(ch) in ('F', 'W', 'H'):
+            value |= LINE_BREAK_EAST_ASIAN_FLAG
+        if unicodedata.category(ch) == 'Cn' and in_ranges(cp, EXTENDED_PICTOGRAPHIC_RANGES):
+            value |= LINE_BREAK_RESERVED_PICTOGRAPHIC_FLAG
+        values.append(value)
+    stage1, stage2 = make_two_stage_table(values)
+    write_table_header(os.path.join(output_dir, 'ofxMixedFontLineBreakTable.hpp'), 'LINE_BREAK', stage1, stage2)
+
+
+def generate_bidi_table(output_dir, ucd_dir):
+    values = [BIDI_CLASSES.index(bidi_class(cp)) for cp in range(MAX_CODE_POINT)]
+    stage1, stage2 = make_two_stage_table(values)
+    # Note: Sorted pairs of (code point, Bidi_Mirroring_Glyph) for L4
+    mirroring_glyphs = format_pair_array('BIDI_MIRRORING_GLYPHS', bidi_mirroring_glyphs(ucd_dir))
+    write_table_header(os.path.join(output_dir, 'ofxMixedFontBidiTable.hpp'), 'BIDI', stage1, stage2, [mirroring_glyphs])
+
+
+def generate_grapheme_break_table(output_dir):
+    overrides = {}
+    for name, code_points in GRAPHEME_CLUSTER_BREAK_OVERRIDES.items():
+        for cp in code_points:
+            overrides[cp] = name
+
+    values = []
+    for cp in range(MAX_CODE_POINT):
+        value = GRAPHEME_CLUSTER_BREAKS.index(grapheme_cluster_break(cp, overrides))
+        if in_ranges(cp, EXTENDED_PICTOGRAPHIC_RANGES):
+            value |= EXTENDED_PICTOGRAPHIC_FLAG
+        values.append(value)
+    stage1, stage2 = make_two_stage_table(values)
+    write_table_header(os.path.join(output_dir, 'ofxMixedFontGraphemeBreakTable.hpp'), 'GRAPHEME_BREAK', stage1, stage2)
+
+
+def main():
+    output_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src')
+    ucd_dir = sys.argv[2] if len(sys.argv) > 2 else None
+    generate_line_break_table(output_dir, ucd_dir)
+    generate_bidi_table(output_dir, ucd_dir)
+    generate_grapheme_break_table(output_dir)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,383 @@
+#include "ofxEditableText.hpp"
+#include "ofxMixedFontLineBreak.hpp"
+
+#include "ofRectangle.h"
+
+#include <algorithm>
+#include <iterator>
+
+static bool IsHardBreak(const char32_t &code_point)
+{
+    ofxMixedFontUtil::ofxLineBreakClass line_break_class = ofxMixedFontUtil::getLineBreakClass(code_point);
+    return (line_break_class == ofxMixedFontUtil::LB_BK || line_break_class == ofxMixedFontUtil::LB_CR
+            || line_break_class == ofxMixedFontUtil::LB_LF || line_break_class == ofxMixedFontUtil::LB_NL);
+}
+
+static bool IsBlank(const ofxMixedFontUtil::ofxGlyphData &glyph)
+{
+    if (glyph.props.code_point.empty()) return false;
+    
+    ofxMixedFontUtil::ofxLineBreakClass line_break_class = ofxMixedFontUtil::getLineBreakClass(glyph.props.code_point[0]);
+    return (line_break_class == ofxMixedFontUtil::LB_SP || line_break_class == ofxMixedFontUtil::LB_ZW || IsHardBreak(glyph.props.code_point[0]));
+}
+
+ofxEditableText::ofxEditableText(const ofxBaseFontPtr &font, const float &max_width)
+: font_(font), max_width_(max_width), coord_(0, 0)
+{
+    relayout();
+}
+
+void ofxEditableText::setText(const std::u32string &utf32_string)
+{
+    text_ = utf32_string;
+    relayout();
+}
+
+void ofxEditableText::setText(const std::string &src_string)
+{
+    setText(ofxMixedFontUtil::utf_converter.from_bytes(src_string));
+}
+
+const std::u32string &ofxEditableText::getText() const
+{
+    return text_;
+}
+
+void ofxEditableText::insert(const int &index, const std::u32string &utf32_string)
+{
+    if (utf32_string.empty()) return;
+    
+    const int edit_begin = std::max(0, std::min(index, static_cast<int>(text_.length())));
+    text_.insert(edit_begin, utf32_string);
+    relayoutFrom(edit_begin, edit_begin, edit_begin + utf32_string.length());
+}
+
+void ofxEditableText::insert(const int &index, const std::string &src_string)
+{
+    insert(index, ofxMixedFontUtil::utf_converter.from_bytes(src_string));
+}
+
+void ofxEditableText::erase(const int &index, const int &length)
+{
+    const int edit_begin = std::max(0, std::min(index, static_cast<int>(text_.length())));
+    const int edit_end = std::max(edit_begin, std::min(index + length, static_cast<int>(text_.length())));
+    if (edit_begin == edit_end) return;
+    
+    text_.erase(edit_begin, edit_end - edit_begin);
+    relayoutFrom(edit_begin, edit_end, edit_begin);
+}
+
+void ofxEditableText::setPosition(const ofPoint &coord)
+{
+    // Note: Lines are moved lazily when they are accessed (see moveLine())
+    coord_ = coord;
+}
+
+ofPoint ofxEditableText::getPosition() const
+{
+    return coord_;
+}
+
+void ofxEditableText::setMaxWidth(const float &max_width)
+{
+    if (max_width_ == max_width) return;
+    
+    max_width_ = max_width;
+    relayout();
+}
+
+float ofxEditableText::getMaxWidth() const
+{
+    return max_width_;
+}
+
+void ofxEditableText::relayout()
+{
+    lines_.clear();
+    
+    const float line_height = font_->getFontProps().line_height;
+    int begin = 0;
+    while (true) {
+        Line line;
+        int end = layoutLine(begin, ofPoint(coord_.x, coord_.y + lines_.size() * line_height), line);
+        lines_.push_back(std::move(line));
+        if (end >= text_.length() && !(end > begin && IsHardBreak(text_[end - 1]))) {
+            break;
+        }
+        begin = end;
+    }
+}
+
+int ofxEditableText::getLineCount() const
+{
+    return lines_.size();
+}
+
+int ofxEditableText::getLineBegin(const int &line) const
+{
+    return lines_.at(line).begin;
+}
+
+int ofxEditableText::getLineLength(const int &line) const
+{
+    return lines_.at(line).length;
+}
+
+int ofxEditableText::getLineIndex(const int &index) const
+{
+    auto it = std::upper_bound(lines_.begin(), lines_.end(), index, [](const int &value, const Line &line) {
+        return value < line.begin;
+    });
+    
+    return std::max(0, static_cast<int>(std::distance(lines_.begin(), it)) - 1);
+}
+
+const std::vector<ofxMixedFontUtil::ofxGlyphData> &ofxEditableText::getLineGlyphs(const int &line)
+{
+    moveLine(line);
+    return lines_.at(line).glyph_list;
+}
+
+int ofxEditableText::getIndexAtPoint(const ofPoint &point)
+{
+    const ofxMixedFontUtil::ofxFontProps font_props = font_->getFontProps();
+    int line = (font_props.line_height > 0.f) ? std::floor((point.y - coord_.y + font_props.ascender_height) / font_props.line_height) : 0;
+    line = std::max(0, std::min(line, static_cast<int>(lines_.size()) - 1));
+    moveLine(line);
+    
+    const Line &target_line = lines_[line];
+    if (target_line.glyph_list.empty()) {
+        return target_line.begin;
+    }
+    
+    auto found = std::upper_bound(target_line.glyph_list.begin(), target_line.glyph_list.end(), point.x, [](const float &value, const ofxMixedFontUtil::ofxGlyphData &glyph) {
+        return value < glyph.coord.x;
+    });
+    const int glyph = std::max(0, static_cast<int>(std::distance(target_line.glyph_list.begin(), found)) - 1);
+    const ofxMixedFontUtil::ofxGlyphData &glyph_data = target_line.glyph_list[glyph];
+    
+    // Note: The caret doesn't go after a line feed or a space which ends a wrapped line, since that is the next line
+    const bool is_last_glyph = (glyph + 1 == target_line.glyph_list.size());
+    if (point.x < glyph_data.coord.x + ofxMixedFontUtil::getGlyphAdvance(font_props, glyph_data.props) / 2.f || (is_last_glyph && IsBlank(glyph_data))) {
+        return target_line.begin + target_line.glyph_offsets[glyph];
+    }
+    
+    auto next = std::upper_bound(target_line.glyph_offsets.begin() + glyph, target_line.glyph_offsets.end(), target_line.glyph_offsets[glyph]);
+    return target_line.begin + ((next != target_line.glyph_offsets.end()) ? *next : target_line.length);
+}
+
+ofRectangle ofxEditableText::getCaretRect(const int &index)
+{
+    const ofxMixedFontUtil::ofxFontProps font_props = font_->getFontProps();
+    const int clamped_index = std::max(0, std::min(index, static_cast<int>(text_.length())));
+    const int line = getLineIndex(clamped_index);
+    moveLine(line);
+    
+    const Line &target_line = lines_[line];
+    const int offset = clamped_index - target_line.begin;
+    float x = target_line.coord.x;
+    if (!target_line.glyph_list.empty()) {
+        if (offset >= target_line.length) {
+            const ofxMixedFontUtil::ofxGlyphData &last_glyph = target_line.glyph_list.back();
+            x = last_glyph.coord.x + ofxMixedFontUtil::getGlyphAdvance(font_props, last_glyph.props);
+        }
+        else {
+            // Note: An index inside a cluster is snapped to the first glyph of the cluster
+            auto found = std::upper_bound(target_line.glyph_offsets.begin(), target_line.glyph_offsets.end(), offset);
+            const int cluster_begin = *std::prev(found);
+            const int glyph = std::distance(target_line.glyph_offsets.begin(), std::lower_bound(target_line.glyph_offsets.begin(), found, cluster_begin));
+            x = target_line.glyph_list[glyph].coord.x;
+        }
+    }
+    
+    return ofRectangle(x, target_line.coord.y - font_props.ascender_height, 1.f, font_props.line_height);
+}
+
+void ofxEditableText::draw()
+{
+    drawLines(0, lines_.size() - 1);
+}
+
+void ofxEditableText::draw(const ofRectangle &viewport)
+{
+    const float line_height = font_->getFontProps().line_height;
+    if (line_height <= 0.f) {
+        draw();
+        return;
+    }
+    
+    // Note: One extra line on each side covers ascenders and descenders
+    int first_line = std::floor((viewport.getTop() - coord_.y) / line_height) - 1;
+    int last_line = std::ceil((viewport.getBottom() - coord_.y) / line_height) + 1;
+    drawLines(std::max(0, first_line), std::min(last_line, static_cast<int>(lines_.size()) - 1));
+}
+
+int ofxEditableText::layoutLine(const int &begin, const ofPoint &coord, Line &line)
+{
+    line.begin = begin;
+    line.coord = coord;
+    line.glyph_begin = begin;
+    line.glyph_list.clear();
+    line.glyph_offsets.clear();
+    
+    const ofxMixedFontUtil::ofxFontProps font_props = font_->getFontProps();
+    const int text_length = text_.length();
+    ofxMixedFontUtil::ofxLineBreaker breaker;
+    float x = 0.f;
+    int line_end = begin;
+    int segment_begin = begin;
+    
+    if (begin < text_length) {
+        breaker.next(text_[begin]);
+    }
+    
+    while (segment_begin < text_length) {
+        // Note: A segment is the text between two break opportunities. Its first character is already fed to the breaker.
+        int segment_end = segment_begin + 1;
+        while (segment_end < text_length && breaker.next(text_[segment_end]) == ofxMixedFontUtil::BREAK_PROHIBITED) {
+            ++segment_end;
+        }
+        const bool is_mandatory = IsHardBreak(text_[segment_end - 1]);
+        
+        segment_buffer_.assign(text_, segment_begin, segment_end - segment_begin);
+        segment_glyphs_.clear();
+        segment_char_ends_.clear();
+        segment_glyph_ends_.clear();
+        for (int index = 0; index < segment_buffer_.length();) {
+            index += std::max(1, font_->appendGlyphData(segment_buffer_, index, segment_glyphs_));
+            segment_char_ends_.push_back(std::min(index, static_cast<int>(segment_buffer_.length())));
+            segment_glyph_ends_.push_back(segment_glyphs_.size());
+        }
+        
+        // Note: Trailing spaces are allowed to hang over the right edge
+        float width = 0.f;
+        float visible_width = 0.f;
+        for (auto &glyph : segment_glyphs_) {
+            width += ofxMixedFontUtil::getGlyphAdvance(font_props, glyph.props);
+            if (!IsBlank(glyph)) visible_width = width;
+        }
+        
+        int glyph_count = segment_glyphs_.size();
+        line_end = segment_end;
+        if (max_width_ > 0.f && x + visible_width > max_width_) {
+            if (segment_begin > begin) {
+                line_end = segment_begin;
+                break;
+            }
+            
+            // Note: A segment longer than max_width is broken between appendGlyphData() calls
+            float call_x = x;
+            int call_count = 0;
+            for (int i = 0; i < segment_glyph_ends_.size(); ++i) {
+                float call_width = 0.f;
+                for (int j = (i == 0) ? 0 : segment_glyph_ends_[i - 1]; j < segment_glyph_ends_[i]; ++j) {
+                    call_width += ofxMixedFontUtil::getGlyphAdvance(font_props, segment_glyphs_[j].props);
+                }
+                if (i > 0 && call_x + call_width > max_width_) break;
+                call_x += call_width;
+                call_count = i + 1;
+            }
+            glyph_count = segment_glyph_ends_[call_count - 1];
+            line_end = segment_begin + segment_char_ends_[call_count - 1];
+        }
+        
+        // Note: Offsets come from the characters of each appendGlyphData() call, and the string index of a glyph refines them in a shaped run
+        for (int call = 0, i = 0; i < glyph_count; ++i) {
+            while (segment_glyph_ends_[call] <= i) ++call;
+            const int call_begin = (call == 0) ? 0 : segment_char_ends_[call - 1];
+            const int call_end = segment_char_ends_[call];
+            ofxMixedFontUtil::ofxGlyphData &glyph = segment_glyphs_[i];
+            const int char_offset = (call_begin <= glyph.string_index && glyph.string_index < call_end) ? glyph.string_index : call_begin;
+            glyph.string_index = segment_begin + char_offset; // Note: index in the whole text
+            glyph.coord = ofPoint(coord.x + x, coord.y);
+            x += ofxMixedFontUtil::getGlyphAdvance(font_props, glyph.props);
+            line.glyph_list.push_back(glyph);
+            line.glyph_offsets.push_back(segment_begin + char_offset - begin);
+        }
+        
+        if (is_mandatory || line_end != segment_end) break;
+        segment_begin = segment_end;
+    }
+    
+    line.length = line_end - begin;
+    return line_end;
+}
+
+void ofxEditableText::relayoutFrom(const int &edit_begin, const int &old_edit_end, const int &new_edit_end)
+{
+    if (lines_.empty()) {
+        relayout();
+        return;
+    }
+    
+    const int delta = new_edit_end - old_edit_end;
+    const int edited_line = getLineIndex(edit_begin);
+    
+    // Note: An edit may pull the first word of the edited line back to the previous line of the same paragraph
+    int first_line = edited_line;
+    if (first_line > 0) {
+        const Line &previous_line = lines_[first_line - 1];
+        if (previous_line.length == 0 || !IsHardBreak(text_[previous_line.begin + previous_line.length - 1])) {
+            --first_line;
+        }
+    }
+    
+    const float line_height = font_->getFontProps().line_height;
+    std::vector<Line> new_lines;
+    int begin = lines_[first_line].begin;
+    int reusable_line = edited_line + 1;
+    while (true) {
+        Line line;
+        int end = layoutLine(begin, ofPoint(coord_.x, coord_.y + (first_line + new_lines.size()) * line_height), line);
+        new_lines.push_back(std::move(line));
+        if (end >= text_.length() && !(end > begin && IsHardBreak(text_[end - 1]))) {
+            reusable_line = lines_.size();
+            break;
+        }
+        begin = end;
+        
+        // Note: Line breaks have stabilized when a new line starts where an old line after the edit started
+        while (reusable_line < lines_.size()
+               && (lines_[reusable_line].begin < old_edit_end || lines_[reusable_line].begin + delta < begin)) {
+            ++reusable_line;
+        }
+        if (reusable_line < lines_.size() && lines_[reusable_line].begin + delta == begin) {
+            break;
+        }
+    }
+    
+    lines_.erase(lines_.begin() + first_line, lines_.begin() + reusable_line);
+    lines_.insert(lines_.begin() + first_line, std::make_move_iterator(new_lines.begin()), std::make_move_iterator(new_lines.end()));
+    for (int i = first_line + new_lines.size(); i < lines_.size(); ++i) {
+        lines_[i].begin += delta;
+    }
+}
+
+void ofxEditableText::moveLine(const int &line)
+{
+    Line &target_line = lines_.at(line);
+    const ofPoint coord(coord_.x, coord_.y + line * font_->getFontProps().line_height);
+    const int index_offset = target_line.begin - target_line.glyph_begin; // Note: A reused line is shifted by edits before it
+    if (target_line.coord == coord && index_offset == 0) return;
+    
+    const ofPoint offset = coord - target_line.coord;
+    for (auto &glyph : target_line.glyph_list) {
+        glyph.coord += offset;
+        glyph.string_index += index_offset;
+    }
+    target_line.coord = coord;
+    target_line.glyph_begin = target_line.begin;
+}
+
+void ofxEditableText::drawLines(const int &first_line, const int &last_line)
+{
+    draw_buffer_.clear();
+    for (int i = first_line; i <= last_line; ++i) {
+        moveLine(i);
+        draw_buffer_.insert(draw_buffer_.end(), lines_[i].glyph_list.begin(), lines_[i].glyph_list.end());
+    }
+    
+    if (!draw_buffer_.empty()) {
+        font_->drawGlyphs(draw_buffer_);
+    }
+}
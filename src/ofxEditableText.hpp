@@ -0,0 +1,75 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "ofxMixedFontUtil.hpp"
+
+class ofRectangle;
+
+typedef std::shared_ptr<ofxMixedFontUtil::ofxBaseFont> ofxBaseFontPtr;
+
+// Note: ofxEditableText keeps the glyphs of each line separately. An edit re-typesets lines from the edited one
+//       until a line starts at the same character as before, and the rest of the lines are reused as they are.
+//       Quads are not cached. draw() builds them from the glyphs of the visible lines.
+class ofxEditableText
+{
+public:
+    ofxEditableText(const ofxBaseFontPtr &font, const float &max_width = 0.f);
+    virtual ~ofxEditableText() {};
+    
+    ofxEditableText(const ofxEditableText &) = delete;
+    ofxEditableText(ofxEditableText &&) = delete;
+    ofxEditableText &operator=(const ofxEditableText &) = delete;
+    ofxEditableText &operator=(ofxEditableText &&) = delete;
+    
+    void setText(const std::u32string &utf32_string);
+    void setText(const std::string &src_string);
+    const std::u32string &getText() const;
+    void insert(const int &index, const std::u32string &utf32_string);
+    void insert(const int &index, const std::string &src_string);
+    void erase(const int &index, const int &length);
+    
+    void setPosition(const ofPoint &coord);
+    ofPoint getPosition() const;
+    void setMaxWidth(const float &max_width);
+    float getMaxWidth() const;
+    void relayout();
+    
+    int getLineCount() const;
+    int getLineBegin(const int &line) const;
+    int getLineLength(const int &line) const;
+    int getLineIndex(const int &index) const;
+    const std::vector<ofxMixedFontUtil::ofxGlyphData> &getLineGlyphs(const int &line);
+    int getIndexAtPoint(const ofPoint &point);
+    ofRectangle getCaretRect(const int &index);
+    
+    void draw();
+    void draw(const ofRectangle &viewport);
+    
+private:
+    typedef struct {
+        int begin;
+        int length;
+        ofPoint coord; // Note: the line origin which coordinates of glyph_list are based on
+        int glyph_begin; // Note: the begin which string indices of glyph_list are based on
+        std::vector<ofxMixedFontUtil::ofxGlyphData> glyph_list;
+        std::vector<int> glyph_offsets; // Note: index of the first character of each glyph, from begin
+    } Line;
+    
+    int layoutLine(const int &begin, const ofPoint &coord, Line &line);
+    void relayoutFrom(const int &edit_begin, const int &old_edit_end, const int &new_edit_end);
+    void moveLine(const int &line);
+    void drawLines(const int &first_line, const int &last_line);
+    
+    ofxBaseFontPtr font_;
+    std::u32string text_;
+    float max_width_;
+    ofPoint coord_;
+    std::vector<Line> lines_;
+    std::u32string segment_buffer_;
+    std::vector<ofxMixedFontUtil::ofxGlyphData> segment_glyphs_;
+    std::vector<int> segment_char_ends_;
+    std::vector<int> segment_glyph_ends_;
+    std::vector<ofxMixedFontUtil::ofxGlyphData> draw_buffer_;
+    
+};
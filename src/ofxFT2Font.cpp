@@ -1,16 +1,33 @@
 #include "ofxFT2Font.hpp"
+#include "ofxMixedFontCompositor.hpp"
+#include "ofxMixedFontGraphemeBreak.hpp"
+#include "ofxMixedFontBlob.hpp"
+#include "ofxMixedFontAtlasCache.hpp"
 
-#include <ft2build.h>
+#include <algorithm>
+#include <map>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <chrono>
 
-#ifdef TARGET_LINUX
-#include <fontconfig/fontconfig.h>
-#endif
+#include <ft2build.h>
 
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
 #include FT_OUTLINE_H
 #include FT_TRIGONOMETRY_H
 #include FT_TRUETYPE_TABLES_H
+#include FT_SIZES_H
+
+#if !defined(OFX_MIXED_FONT_USE_HARFBUZZ) && defined(TARGET_OSX)
+#define OFX_MIXED_FONT_USE_HARFBUZZ // Note: libs/harfbuzz/lib/osx/libharfbuzz.a
+#endif
+
+#ifdef OFX_MIXED_FONT_USE_HARFBUZZ
+#include <hb.h>
+#include <hb-ft.h>
+#endif
 
 #include "ofUtils.h"
 #include "ofPixels.h"
@@ -19,7 +36,38 @@
 #include "ofPath.h"
 
 std::shared_ptr<FT_LibraryRec_> ofxFT2Font::ft_library_;
+std::mutex ofxFT2Font::ft_library_mutex_;
 const int ofxFT2Font::ATLAS_TEXTURE_SIZE = GL_MAX_TEXTURE_SIZE;
+int ofxFT2Font::render_state_depth_ = 0;
+bool ofxFT2Font::render_state_blend_is_enabled_ = false;
+int ofxFT2Font::render_state_blend_src_ = GL_ONE;
+int ofxFT2Font::render_state_blend_dst_ = GL_ZERO;
+int ofxFT2Font::render_state_current_sfactor_ = -1;
+bool ofxFT2Font::is_batching_ = false;
+std::vector<std::shared_ptr<ofxFT2Font>> ofxFT2Font::batched_fonts_;
+
+#ifdef OFX_MIXED_FONT_USE_HARFBUZZ
+struct ofxFT2Font::HarfBuzzState {
+    std::shared_ptr<hb_font_t> font;
+    std::shared_ptr<hb_buffer_t> buffer;
+    std::vector<hb_feature_t> features;
+    std::string features_key;
+    std::unordered_map<std::string, std::shared_ptr<hb_shape_plan_t>> shape_plans;
+};
+#else
+struct ofxFT2Font::HarfBuzzState {};
+#endif
+
+struct ofxSharedFTFace {
+    std::shared_ptr<const ofxMixedFontUtil::ofxFontBlob> blob;
+    std::shared_ptr<FT_FaceRec_> face;
+    std::recursive_mutex mutex;
+};
+
+static std::mutex shared_face_registry_mutex;
+static std::map<std::pair<std::string, int>, std::weak_ptr<ofxSharedFTFace>> shared_face_registry; // Note: (file path, face index) -> face
+
+static const unsigned long long EMPTY_KERNING_KEY = ~0ULL;
 
 static std::shared_ptr<FT_LibraryRec_> initFTLibrary()
 {
@@ -45,24 +93,115 @@ static std::string resolveFontFilePath(const std::string &file_name)
     return file_path;
 }
 
-static std::shared_ptr<FT_FaceRec_> initFTFace(std::shared_ptr<FT_LibraryRec_> ft_library, const std::string &file_name)
+static std::shared_ptr<FT_FaceRec_> initFTFace(std::shared_ptr<FT_LibraryRec_> ft_library, std::shared_ptr<const ofxMixedFontUtil::ofxFontBlob> blob, const std::string &file_name, const int &face_index)
+{
+    FT_FaceRec_ *ft_face;
+    FT_Error err = FT_New_Memory_Face(ft_library.get(), blob->getData(), blob->getSize(), face_index, &ft_face);
+    if (err) {
+        string errorString = "unknown font type or face index";
+        ofLogError("ofxFT2Font") << "initFTFace(): couldn't create new face #" << face_index << " for \"" << file_name << "\": FT_Error " << err << " " << errorString;
+        return std::shared_ptr<FT_FaceRec_>();
+    }
+    
+    // Note: Faces of the same file share one memory mapping, which is kept alive by the deleter of each face.
+    //       FT_New_Memory_Face() is called under shared_face_registry_mutex, and FT_Done_Face() must be serialized with it
+    return std::shared_ptr<FT_FaceRec_>(ft_face, [blob](FT_FaceRec_ *face) {
+        std::lock_guard<std::mutex> lock(shared_face_registry_mutex);
+        FT_Done_Face(face);
+    });
+}
+
+static std::shared_ptr<ofxSharedFTFace> acquireSharedFace(std::shared_ptr<FT_LibraryRec_> ft_library, const std::string &file_name, const int &face_index)
 {
     std::string file_path = resolveFontFilePath(file_name);
     if (file_path.empty()) {
-        return std::shared_ptr<FT_FaceRec_>();
+        return std::shared_ptr<ofxSharedFTFace>();
+    }
+    if (face_index < 0) {
+        ofLogError("ofxFT2Font") << "acquireSharedFace(): invalid face index " << face_index << " for \"" << file_name << "\"";
+        return std::shared_ptr<ofxSharedFTFace>();
     }
     
-    int font_id = 0;
-    FT_FaceRec_ *ft_face;
-    FT_Error err = FT_New_Face(ft_library.get(), file_path.c_str(), font_id, &ft_face);
+    std::lock_guard<std::mutex> lock(shared_face_registry_mutex);
+    auto found = shared_face_registry.find(std::make_pair(file_path, face_index));
+    if (found != shared_face_registry.end()) {
+        std::shared_ptr<ofxSharedFTFace> shared_face = found->second.lock();
+        if (shared_face) {
+            return shared_face;
+        }
+        shared_face_registry.erase(found);
+    }
+    
+    std::shared_ptr<ofxSharedFTFace> shared_face = std::make_shared<ofxSharedFTFace>();
+    shared_face->blob = ofxMixedFontUtil::ofxFontBlob::open(file_path);
+    if (!shared_face->blob) {
+        ofLogError("ofxFT2Font") << "acquireSharedFace(): couldn't map font \"" << file_name << "\"";
+        return std::shared_ptr<ofxSharedFTFace>();
+    }
+    shared_face->face = initFTFace(ft_library, shared_face->blob, file_name, face_index);
+    if (!shared_face->face) {
+        return std::shared_ptr<ofxSharedFTFace>();
+    }
+    shared_face_registry[std::make_pair(file_path, face_index)] = shared_face;
+    
+    return shared_face;
+}
+
+static std::shared_ptr<FT_SizeRec_> initFTSize(std::shared_ptr<ofxSharedFTFace> shared_face)
+{
+    std::lock_guard<std::recursive_mutex> lock(shared_face->mutex);
+    FT_SizeRec_ *ft_size;
+    FT_Error err = FT_New_Size(shared_face->face.get(), &ft_size);
     if (err) {
-        string errorString = "unknown font type";
-        if(err == 1) errorString = "invalid filename";
-        ofLogError("ofxFT2Font") << "initFTFace(): couldn't create new face for \"" << file_name << "\": FT_Error " << err << " " << errorString;
-        return std::shared_ptr<FT_FaceRec_>();
+        ofLogError("ofxFT2Font") << "initFTSize(): couldn't create new size: FT_Error " << err;
+        return std::shared_ptr<FT_SizeRec_>();
     }
     
-    return std::shared_ptr<FT_FaceRec_>(ft_face, FT_Done_Face);
+    // Note: The size keeps the face alive, since FT_Done_Size() needs it
+    return std::shared_ptr<FT_SizeRec_>(ft_size, [shared_face](FT_SizeRec_ *size) {
+        std::lock_guard<std::recursive_mutex> lock(shared_face->mutex);
+        FT_Done_Size(size);
+    });
+}
+
+static bool HasSfntTable(std::shared_ptr<FT_FaceRec_> ft_face, const FT_ULong &tag)
+{
+    FT_ULong length = 0;
+    FT_Load_Sfnt_Table(ft_face.get(), tag, 0, nullptr, &length);
+    return length > 0;
+}
+
+static unsigned long long MakeKerningKey(const int &left_glyph_id, const int &right_glyph_id)
+{
+    return (static_cast<unsigned long long>(left_glyph_id) << 32) | static_cast<unsigned int>(right_glyph_id);
+}
+
+// Note: Glyph pairs of the horizontal format 0 subtables of the OpenType kern table, which FT_Get_Kerning() reads
+static void getKernTablePairs(std::shared_ptr<FT_FaceRec_> ft_face, std::vector<std::pair<int, int>> &pairs)
+{
+    FT_ULong length = 0;
+    FT_Load_Sfnt_Table(ft_face.get(), FT_MAKE_TAG('k', 'e', 'r', 'n'), 0, nullptr, &length);
+    if (length < 4) return;
+    
+    std::vector<FT_Byte> table(length);
+    if (FT_Load_Sfnt_Table(ft_face.get(), FT_MAKE_TAG('k', 'e', 'r', 'n'), 0, table.data(), &length) != 0) return;
+    
+    auto read16 = [&table](const std::size_t &offset) { return (table[offset] << 8) | table[offset + 1]; };
+    if (read16(0) != 0) return; // Note: Apple's version 1 table isn't read
+    
+    std::size_t offset = 4;
+    for (int i = 0, subtable_count = read16(2); i < subtable_count && offset + 14 <= length; ++i) {
+        const std::size_t subtable_length = read16(offset + 2);
+        const int coverage = read16(offset + 4);
+        if ((coverage >> 8) == 0 && (coverage & 0x1)) {
+            const int pair_count = read16(offset + 6);
+            for (int j = 0; j < pair_count && offset + 14 + (j + 1) * 6 <= length; ++j) {
+                pairs.push_back(std::make_pair(read16(offset + 14 + j * 6), read16(offset + 16 + j * 6)));
+            }
+        }
+        if (subtable_length < 14) break;
+        offset += subtable_length;
+    }
 }
 
 static bool IsColorBitmapFont(std::shared_ptr<FT_FaceRec_> ft_face) {
@@ -206,34 +345,31 @@ static ofPath makeContoursForCharacter(const FT_Outline &outline)
     return charOutlines;
 }
 
-int ofxFT2Font::initialize(const std::string &file_name, float font_size_pt)
+int ofxFT2Font::initialize(const std::string &file_name, float font_size_pt, int face_index)
 {
-    if (!ft_library_) {
-        ft_library_ = initFTLibrary();
+    {
+        std::lock_guard<std::mutex> lock(ft_library_mutex_);
         if (!ft_library_) {
-            return -1;
+            ft_library_ = initFTLibrary();
+            if (!ft_library_) {
+                return -1;
+            }
         }
     }
     
-    /*
-     #ifdef TARGET_LINUX
-     FcBool result = FcInit();
-     if(!result){
-     return -10;
-     }
-     #endif
-     #ifdef TARGET_WIN32
-     initWindows();
-     #endif
-     */
-    
-    ft_face_ = initFTFace(ft_library_, file_name);
-    if (!ft_face_) {
-        ft_face_.reset();
+    releaseFace();
+    std::shared_ptr<ofxSharedFTFace> shared_face = acquireSharedFace(ft_library_, file_name, face_index);
+    std::shared_ptr<FT_SizeRec_> ft_size = shared_face ? initFTSize(shared_face) : std::shared_ptr<FT_SizeRec_>();
+    if (!ft_size) {
         return -2;
     }
+    shared_face_ = shared_face;
+    ft_size_ = ft_size;
+    ft_face_ = shared_face->face;
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
     
     is_mono_font_ = IsColorBitmapFont(ft_face_) ? false : true;
+    has_gpos_table_ = HasSfntTable(ft_face_, FT_MAKE_TAG('G', 'P', 'O', 'S'));
     bool is_ok = false;
     if (is_mono_font_) {
         is_ok = setFTCharSize(ft_face_, font_size_pt, ofxMixedFontUtil::DPI);
@@ -244,7 +380,8 @@ int ofxFT2Font::initialize(const std::string &file_name, float font_size_pt)
     }
     
     if (!is_ok) {
-        ft_face_.reset();
+        face_lock.unlock();
+        releaseFace();
         return -3;
     }
     
@@ -262,16 +399,30 @@ int ofxFT2Font::initialize(const std::string &file_name, float font_size_pt)
         atlas_pixels_->allocate(ATLAS_TEXTURE_SIZE, ATLAS_TEXTURE_SIZE, 4);
     }
     
-    atlas_texture_ = std::shared_ptr<ofTexture>(new ofTexture());
-    atlas_texture_->allocate(*atlas_pixels_);
+    atlas_offset_x_ = 0;
+    atlas_offset_y_ = 0;
+    next_atlas_offset_y_ = 0;
+    
+    atlas_texture_needs_allocation_ = true;
+    atlas_pixels_have_been_updated_ = true;
     string_quads_ = std::shared_ptr<ofMesh>(new ofMesh());
     
     std::vector<ofxMixedFontUtil::ofxGlyphData>().swap(loaded_glyphs_);
     std::vector<ofPath>().swap(loaded_glyph_outlines_);
+    std::vector<int>().swap(loaded_glyph_ids_);
+    std::vector<unsigned char>().swap(loaded_glyph_states_);
+    std::unordered_map<int, int>().swap(glyph_id_indices_);
+    std::unordered_map<std::u32string, int>().swap(sequence_indices_);
+    std::vector<ofxMixedFontUtil::ofxGlyphData>().swap(subpixel_variants_);
+    std::unordered_map<unsigned long long, int>().swap(subpixel_variant_indices_);
+    std::vector<KerningPair>().swap(kerning_pairs_);
+    kerning_pair_count_ = 0;
+    hb_state_.reset();
+    clearTypesetCache();
     
     file_path_ = file_name;
+    face_index_ = face_index;
     
-    is_ready_ = true;
     texture_is_enabled_ = true;
     path_is_enabled_ = is_mono_font_;
     
@@ -283,28 +434,69 @@ int ofxFT2Font::initialize(const std::string &file_name, float font_size_pt)
     font_props_.descender_height = (ft_face_->size->metrics.descender >> 6) * internal_scale_factor_;
     
     if (setNotDefGlyphProps() != 0) {
-        ft_face_.reset();
+        face_lock.unlock();
+        releaseFace();
         return -4;
     }
+    rasterizeGlyph(0); // Note: .notdef stands in for glyphs that don't fit in the atlas, so it takes its place first
     if (setSpaceGlyphProps() != 0) {
-        ft_face_.reset();
+        face_lock.unlock();
+        releaseFace();
         return -5;
     }
     if (setFullWidthSpaceGlyphProps() != 0) {
-        ft_face_.reset();
+        face_lock.unlock();
+        releaseFace();
         return -6;
     }
     if (setLineFeedGlyphProps() != 0) {
-        ft_face_.reset();
+        face_lock.unlock();
+        releaseFace();
         return -7;
     }
     
+    ++load_generation_;
+    is_ready_ = true;
+    
     return 0;
 }
 
+std::shared_future<int> ofxFT2Font::loadAsync(const std::string &file_name, float font_size_pt, int face_index)
+{
+    if (load_future_.valid() && load_future_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        ofLogError("ofxFT2Font") << "loadAsync(): \"" << file_name << "\" is requested while another file is loading";
+        return load_future_;
+    }
+    
+    // Note: The destructor waits for the thread, so that it never outlives the font
+    is_ready_ = false;
+    load_future_ = std::async(std::launch::async, [this, file_name, font_size_pt, face_index]() {
+        return initialize(file_name, font_size_pt, face_index);
+    }).share();
+    
+    return load_future_;
+}
+
 int ofxFT2Font::reset()
 {
-    return initialize(file_path_, font_props_.font_size_pt);
+    return initialize(file_path_, font_props_.font_size_pt, face_index_);
+}
+
+std::unique_lock<std::recursive_mutex> ofxFT2Font::lockFace() const
+{
+    std::unique_lock<std::recursive_mutex> lock(shared_face_->mutex);
+    FT_Activate_Size(ft_size_.get());
+    
+    return lock;
+}
+
+void ofxFT2Font::releaseFace()
+{
+    is_ready_ = false;
+    hb_state_.reset();
+    ft_size_.reset();
+    ft_face_.reset();
+    shared_face_.reset();
 }
 
 bool ofxFT2Font::selectDrawingMode(const DrawingMode &drawing_mode) {
@@ -328,16 +520,403 @@ bool ofxFT2Font::selectDrawingMode(const DrawingMode &drawing_mode) {
     return is_successful;
 }
 
+bool ofxFT2Font::setKerningEnabled(const bool &is_enabled)
+{
+    kerning_is_enabled_ = is_enabled;
+    return true;
+}
+
+bool ofxFT2Font::kerningIsEnabled() const
+{
+    return kerning_is_enabled_;
+}
+
+bool ofxFT2Font::setSubpixelPhaseCount(const int &phase_count)
+{
+    if (phase_count < 1 || 4 < phase_count) {
+        ofLogError("ofxFT2Font") << "setSubpixelPhaseCount(): phase count must be from 1 to 4";
+        return false;
+    }
+    
+    subpixel_phase_count_ = phase_count;
+    return true;
+}
+
+int ofxFT2Font::getSubpixelPhaseCount() const
+{
+    return subpixel_phase_count_;
+}
+
+int ofxFT2Font::getKerning(const int &left_glyph_id, const int &right_glyph_id)
+{
+    if (!isReady() || left_glyph_id < 0 || right_glyph_id < 0) return 0;
+    
+    unsigned long long key = MakeKerningKey(left_glyph_id, right_glyph_id);
+    int slot = findKerningPair(key);
+    if (slot >= 0) {
+        return kerning_pairs_[slot].adjustment;
+    }
+    
+    int adjustment = computeKerning(left_glyph_id, right_glyph_id);
+    addKerningPair(key, adjustment);
+    
+    return adjustment;
+}
+
+int ofxFT2Font::preloadGlyphs(const std::u32string &utf32_characters)
+{
+    if (!isReady()) return 0;
+    
+    std::vector<int> glyph_ids;
+    for (char32_t character : utf32_characters) {
+        int glyph_index = getGlyphIndex(std::u32string(1, character));
+        if (glyph_index <= 0 || rasterizeGlyph(glyph_index) != 0) {
+            continue;
+        }
+        glyph_ids.push_back(loaded_glyphs_[glyph_index].props.glyph_id);
+    }
+    
+    // Note: Only pairs listed in the kern table are precomputed, and zero adjustments aren't kept.
+    //       Other pairs (ex. GPOS pairs, which are measured by shaping) are cached by getKerning() on first use.
+#ifdef OFX_MIXED_FONT_USE_HARFBUZZ
+    const bool pairs_need_shaping = has_gpos_table_;
+#else
+    const bool pairs_need_shaping = false;
+#endif
+    if (kerning_is_enabled_ && !pairs_need_shaping && FT_HAS_KERNING(ft_face_.get())) {
+        std::unordered_set<int> preloaded_glyph_ids(glyph_ids.begin(), glyph_ids.end());
+        std::vector<std::pair<int, int>> pairs;
+        {
+            std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+            getKernTablePairs(ft_face_, pairs);
+        }
+        for (auto &pair : pairs) {
+            if (preloaded_glyph_ids.count(pair.first) == 0 || preloaded_glyph_ids.count(pair.second) == 0) {
+                continue;
+            }
+            unsigned long long key = MakeKerningKey(pair.first, pair.second);
+            if (findKerningPair(key) >= 0) {
+                continue;
+            }
+            int adjustment = computeKerning(pair.first, pair.second);
+            if (adjustment != 0) {
+                addKerningPair(key, adjustment);
+            }
+        }
+    }
+    
+    return glyph_ids.size();
+}
+
+int ofxFT2Font::findKerningPair(const unsigned long long &key) const
+{
+    if (kerning_pairs_.empty()) {
+        return -1;
+    }
+    
+    const std::size_t mask = kerning_pairs_.size() - 1;
+    for (std::size_t slot = (key * 0x9E3779B97F4A7C15ULL) >> 32 & mask; kerning_pairs_[slot].key != EMPTY_KERNING_KEY; slot = (slot + 1) & mask) {
+        if (kerning_pairs_[slot].key == key) {
+            return slot;
+        }
+    }
+    
+    return -1;
+}
+
+void ofxFT2Font::addKerningPair(const unsigned long long &key, const int &adjustment)
+{
+    // Note: open addressing with linear probing, kept at most half full
+    if ((kerning_pair_count_ + 1) * 2 > kerning_pairs_.size()) {
+        std::vector<KerningPair> old_pairs(std::max<std::size_t>(64, kerning_pairs_.size() * 2), KerningPair{ EMPTY_KERNING_KEY, 0 });
+        old_pairs.swap(kerning_pairs_);
+        kerning_pair_count_ = 0;
+        for (auto &pair : old_pairs) {
+            if (pair.key != EMPTY_KERNING_KEY) {
+                addKerningPair(pair.key, pair.adjustment);
+            }
+        }
+    }
+    
+    const std::size_t mask = kerning_pairs_.size() - 1;
+    std::size_t slot = (key * 0x9E3779B97F4A7C15ULL) >> 32 & mask;
+    while (kerning_pairs_[slot].key != EMPTY_KERNING_KEY && kerning_pairs_[slot].key != key) {
+        slot = (slot + 1) & mask;
+    }
+    if (kerning_pairs_[slot].key == EMPTY_KERNING_KEY) {
+        ++kerning_pair_count_;
+    }
+    kerning_pairs_[slot].key = key;
+    kerning_pairs_[slot].adjustment = adjustment;
+}
+
+int ofxFT2Font::computeKerning(const int &left_glyph_id, const int &right_glyph_id)
+{
+#ifdef OFX_MIXED_FONT_USE_HARFBUZZ
+    // Note: GPOS pair adjustment is measured by shaping the pair
+    auto left = glyph_id_indices_.find(left_glyph_id);
+    auto right = glyph_id_indices_.find(right_glyph_id);
+    if (has_gpos_table_ && left != glyph_id_indices_.end() && right != glyph_id_indices_.end()) {
+        std::u32string pair_string = loaded_glyphs_[left->second].props.code_point + loaded_glyphs_[right->second].props.code_point;
+        std::vector<ShapedGlyph> shaped_glyphs = shapeString(pair_string, 0, pair_string.length());
+        if (shaped_glyphs.size() == 2 && shaped_glyphs[0].glyph_id == left_glyph_id && shaped_glyphs[1].glyph_id == right_glyph_id) {
+            return std::round(shaped_glyphs[0].x_advance) - loaded_glyphs_[left->second].props.advance;
+        }
+    }
+#endif
+    
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+    if (FT_HAS_KERNING(ft_face_.get())) {
+        FT_Vector delta;
+        if (FT_Get_Kerning(ft_face_.get(), left_glyph_id, right_glyph_id, FT_KERNING_DEFAULT, &delta) == 0) {
+            return (delta.x >> 6) * internal_scale_factor_;
+        }
+    }
+    
+    return 0;
+}
+
+bool ofxFT2Font::shapingIsAvailable()
+{
+#ifdef OFX_MIXED_FONT_USE_HARFBUZZ
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ofxFT2Font::setShapingEnabled(const bool &is_enabled)
+{
+    if (is_enabled && !shapingIsAvailable()) {
+        ofLogWarning("ofxFT2Font") << "setShapingEnabled(): HarfBuzz is not available on this build";
+        return false;
+    }
+    
+    shaping_is_enabled_ = is_enabled;
+    return true;
+}
+
+bool ofxFT2Font::shapingIsEnabled() const
+{
+    return shaping_is_enabled_;
+}
+
+void ofxFT2Font::setShapingOptions(const ShapingOptions &options)
+{
+    shaping_options_ = options;
+    
+#ifdef OFX_MIXED_FONT_USE_HARFBUZZ
+    if (hb_state_) {
+        hb_state_->features.clear();
+        hb_state_->features_key.clear();
+        for (auto &feature_string : shaping_options_.features) {
+            hb_feature_t feature;
+            if (hb_feature_from_string(feature_string.c_str(), -1, &feature)) {
+                hb_state_->features.push_back(feature);
+                hb_state_->features_key += feature_string + ",";
+            }
+            else {
+                ofLogWarning("ofxFT2Font") << "setShapingOptions(): invalid feature \"" << feature_string << "\"";
+            }
+        }
+    }
+#endif
+}
+
+std::size_t ofxFT2Font::getTypesetConfigHash() const
+{
+    // Note: The load generation tells apart glyph runs of another file, face or size after initialize() or loadAtlasCache()
+    std::size_t hash = ofxBaseFont::getTypesetConfigHash();
+    hash = ofxMixedFontUtil::combineHash(hash, load_generation_.load());
+    hash = ofxMixedFontUtil::combineHash(hash, kerning_is_enabled_);
+    hash = ofxMixedFontUtil::combineHash(hash, shaping_is_enabled_);
+    if (shaping_is_enabled_) {
+        hash = ofxMixedFontUtil::combineHash(hash, std::hash<std::string>()(shaping_options_.script));
+        hash = ofxMixedFontUtil::combineHash(hash, std::hash<std::string>()(shaping_options_.language));
+        hash = ofxMixedFontUtil::combineHash(hash, shaping_options_.direction);
+        for (auto &feature : shaping_options_.features) {
+            hash = ofxMixedFontUtil::combineHash(hash, std::hash<std::string>()(feature));
+        }
+    }
+    
+    return hash;
+}
+
+ofxFT2Font::ShapingOptions ofxFT2Font::getShapingOptions() const
+{
+    return shaping_options_;
+}
+
+std::vector<ofxFT2Font::ShapedGlyph> ofxFT2Font::shapeString(const std::u32string &utf32_string, const int &index, const int &length)
+{
+    std::vector<ShapedGlyph> shaped_glyphs;
+    
+#ifdef OFX_MIXED_FONT_USE_HARFBUZZ
+    if (!isReady() || !ft_face_ || length <= 0) return shaped_glyphs;
+    
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+    if (!hb_state_) {
+        hb_font_t *font = hb_ft_font_create_referenced(ft_face_.get());
+        hb_ft_font_set_load_flags(font, is_mono_font_ ? FT_LOAD_DEFAULT : FT_LOAD_COLOR);
+        
+        hb_state_ = std::make_shared<HarfBuzzState>();
+        hb_state_->font = std::shared_ptr<hb_font_t>(font, hb_font_destroy);
+        hb_state_->buffer = std::shared_ptr<hb_buffer_t>(hb_buffer_create(), hb_buffer_destroy);
+        
+        // Note: Characters of RTL runs are already mirrored by typesetGlyphs() (L4), so HarfBuzz must not mirror them back
+        hb_unicode_funcs_t *unicode_funcs = hb_unicode_funcs_create(hb_unicode_funcs_get_default());
+        hb_unicode_funcs_set_mirroring_func(unicode_funcs, [](hb_unicode_funcs_t *, hb_codepoint_t code_point, void *) -> hb_codepoint_t {
+            return code_point;
+        }, nullptr, nullptr);
+        hb_buffer_set_unicode_funcs(hb_state_->buffer.get(), unicode_funcs);
+        hb_unicode_funcs_destroy(unicode_funcs);
+        setShapingOptions(shaping_options_);
+    }
+    
+    hb_buffer_t *buffer = hb_state_->buffer.get();
+    hb_buffer_clear_contents(buffer);
+    hb_buffer_add_utf32(buffer, reinterpret_cast<const uint32_t *>(utf32_string.data()), utf32_string.length(), index, length);
+    if (!shaping_options_.script.empty()) {
+        hb_buffer_set_script(buffer, hb_script_from_string(shaping_options_.script.c_str(), -1));
+    }
+    if (!shaping_options_.language.empty()) {
+        hb_buffer_set_language(buffer, hb_language_from_string(shaping_options_.language.c_str(), -1));
+    }
+    if (shaping_options_.direction != DIRECTION_AUTO) {
+        hb_buffer_set_direction(buffer, (shaping_options_.direction == DIRECTION_RTL) ? HB_DIRECTION_RTL : HB_DIRECTION_LTR);
+    }
+    hb_buffer_guess_segment_properties(buffer);
+    
+    hb_segment_properties_t props;
+    hb_buffer_get_segment_properties(buffer, &props);
+    char script_tag[5] = {};
+    hb_tag_to_string(hb_script_to_iso15924_tag(props.script), script_tag);
+    const char *language = hb_language_to_string(props.language);
+    std::string plan_key = std::string(script_tag) + "|" + (language ? language : "") + "|" + hb_direction_to_string(props.direction) + "|" + hb_state_->features_key;
+    
+    auto found = hb_state_->shape_plans.find(plan_key);
+    if (found == hb_state_->shape_plans.end()) {
+        hb_shape_plan_t *plan = hb_shape_plan_create_cached(hb_font_get_face(hb_state_->font.get()), &props, hb_state_->features.data(), hb_state_->features.size(), nullptr);
+        found = hb_state_->shape_plans.emplace(plan_key, std::shared_ptr<hb_shape_plan_t>(plan, hb_shape_plan_destroy)).first;
+    }
+    hb_shape_plan_execute(found->second.get(), hb_state_->font.get(), buffer, hb_state_->features.data(), hb_state_->features.size());
+    
+    unsigned int glyph_count = 0;
+    hb_glyph_info_t *infos = hb_buffer_get_glyph_infos(buffer, &glyph_count);
+    hb_glyph_position_t *positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
+    const float scale = internal_scale_factor_ / 64.f;
+    
+    shaped_glyphs.reserve(glyph_count);
+    for (unsigned int i = 0; i < glyph_count; ++i) {
+        ShapedGlyph glyph = {
+            static_cast<int>(infos[i].codepoint),
+            static_cast<int>(infos[i].cluster),
+            positions[i].x_advance * scale,
+            positions[i].y_advance * scale,
+            positions[i].x_offset * scale,
+            positions[i].y_offset * scale
+        };
+        shaped_glyphs.push_back(glyph);
+    }
+    
+    // Note: Glyphs are returned in logical order. Bidi reordering is done by the composition function.
+    if (HB_DIRECTION_IS_BACKWARD(props.direction)) {
+        std::reverse(shaped_glyphs.begin(), shaped_glyphs.end());
+    }
+#endif
+    
+    return shaped_glyphs;
+}
+
+void ofxFT2Font::beginRenderState()
+{
+    if (render_state_depth_++ > 0) {
+        return;
+    }
+    
+    render_state_blend_is_enabled_ = glIsEnabled(GL_BLEND);
+    glGetIntegerv(GL_BLEND_SRC, &render_state_blend_src_);
+    glGetIntegerv(GL_BLEND_DST, &render_state_blend_dst_);
+    render_state_current_sfactor_ = -1; // Note: blend func is set by the first bind() in this scope
+}
+
+void ofxFT2Font::endRenderState()
+{
+    if (render_state_depth_ == 0) {
+        ofLogWarning("ofxFT2Font") << "endRenderState(): called without beginRenderState()";
+        return;
+    }
+    if (--render_state_depth_ > 0) {
+        return;
+    }
+    
+    if (render_state_current_sfactor_ != -1) {
+        if (!render_state_blend_is_enabled_) {
+            glDisable(GL_BLEND);
+        }
+        glBlendFunc(render_state_blend_src_, render_state_blend_dst_);
+    }
+    render_state_current_sfactor_ = -1;
+}
+
+void ofxFT2Font::beginBatch()
+{
+    if (is_batching_) {
+        ofLogWarning("ofxFT2Font") << "beginBatch(): batch has already begun";
+        return;
+    }
+    
+    is_batching_ = true;
+}
+
+void ofxFT2Font::endBatch()
+{
+    if (!is_batching_) {
+        ofLogWarning("ofxFT2Font") << "endBatch(): called without beginBatch()";
+        return;
+    }
+    
+    is_batching_ = false;
+    
+    beginRenderState();
+    ofPushMatrix();
+    ofLoadIdentityMatrix();
+    for (auto &font : batched_fonts_) {
+        // Note: A font reloaded by loadAsync() after its draw drops its quads
+        if (font->isReady()) {
+            font->bind();
+            font->unbind();
+        }
+        font->has_batched_quads_ = false;
+    }
+    ofPopMatrix();
+    endRenderState();
+    
+    batched_fonts_.clear();
+}
+
+bool ofxFT2Font::isBatching()
+{
+    return is_batching_;
+}
+
 ofxFT2Font::ofxFT2Font()
-: file_path_(""), is_mono_font_(true), drawing_mode_(TEXTURE_MODE), internal_scale_factor_(1.0), atlas_pixels_have_been_updated_(false), atlas_offset_x_(0), atlas_offset_y_(0), next_atlas_offset_y_(0)
+: file_path_(""), face_index_(0), load_generation_(0), is_mono_font_(true), drawing_mode_(TEXTURE_MODE), internal_scale_factor_(1.0), subpixel_phase_count_(1), kerning_pair_count_(0), kerning_is_enabled_(false), has_gpos_table_(false), shaping_is_enabled_(false), atlas_texture_(new ofTexture()), atlas_texture_needs_allocation_(false), atlas_pixels_have_been_updated_(false), atlas_offset_x_(0), atlas_offset_y_(0), next_atlas_offset_y_(0), has_batched_quads_(false)
 {
     
 }
 
-ofxFT2Font::ofxFT2Font(const std::string &file_name, float font_size_pt)
+ofxFT2Font::ofxFT2Font(const std::string &file_name, float font_size_pt, int face_index)
 : ofxFT2Font()
 {
-    initialize(file_name, font_size_pt);
+    initialize(file_name, font_size_pt, face_index);
+}
+
+ofxFT2Font::~ofxFT2Font()
+{
+    if (load_future_.valid()) {
+        load_future_.wait();
+    }
 }
 
 ofxMixedFontUtil::ofxGlyphData ofxFT2Font::makeGlyphData(const std::u32string &utf32_character, const int &index, int &length)
@@ -346,18 +925,90 @@ ofxMixedFontUtil::ofxGlyphData ofxFT2Font::makeGlyphData(const std::u32string &u
     if (!isReady()) return ofxMixedFontUtil::ofxGlyphData();
     
     length = 0;
-    ofxMixedFontUtil::ofxGlyphData glyph = { shared_from_this(), loaded_glyphs_[0].props, ofPoint(0, 0) }; // NotDef Glyph
+    ofxMixedFontUtil::ofxGlyphData glyph = { shared_from_this(), loaded_glyphs_[0].props, ofPoint(0, 0), 0, 0 }; // NotDef Glyph
 
+    // Note: A multi code point grapheme cluster (ex. emoji sequence) is drawn as one glyph when the font has a ligature for it
+    const int cluster_length = ofxMixedFontUtil::getGraphemeClusterLength(utf32_character, index);
+    if (cluster_length > 1) {
+        std::u32string sequence = utf32_character.substr(index, cluster_length);
+        int glyph_index = getSequenceGlyphIndex(sequence);
+        if (glyph_index > 0) {
+            glyph.props = loaded_glyphs_[glyph_index].props;
+            glyph.props.code_point = sequence;
+            length = cluster_length;
+            return glyph;
+        }
+    }
+    
     std::u32string code_point = { utf32_character[index] };
     int glyph_index = getGlyphIndex(code_point);
     if (glyph_index > 0) {
         glyph.props = loaded_glyphs_[glyph_index].props;
+        glyph.props.code_point = code_point; // Note: Characters which share a glyph (ex. U+00C5 and U+212B) share its entry
         ++length;
     }
     
     return glyph;
 }
 
+int ofxFT2Font::appendGlyphData(const std::u32string &utf32_string, const int &index, std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list)
+{
+    if (!isReady()) return ofxBaseFont::appendGlyphData(utf32_string, index, glyph_list);
+    
+    if (!shaping_is_enabled_) {
+        int length = ofxBaseFont::appendGlyphData(utf32_string, index, glyph_list);
+        
+        // Note: Kerning is folded into the advance of the preceding glyph. (Shaped runs are kerned by HarfBuzz.)
+        if (kerning_is_enabled_ && length > 0 && glyph_list.size() >= 2) {
+            ofxMixedFontUtil::ofxGlyphData &previous_glyph = glyph_list[glyph_list.size() - 2];
+            const ofxMixedFontUtil::ofxGlyphData &current_glyph = glyph_list.back();
+            if (previous_glyph.props.glyph_id >= 0 && current_glyph.props.glyph_id >= 0 && previous_glyph.font.lock() == shared_from_this()) {
+                previous_glyph.props.advance += getKerning(previous_glyph.props.glyph_id, current_glyph.props.glyph_id);
+            }
+        }
+        
+        return length;
+    }
+    
+    // Note: A run ends at a line feed or at a character which this font doesn't have, so that ofxMixedFont can pass it to the next font
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+    int run_end = index;
+    while (run_end < utf32_string.length() && utf32_string[run_end] != U'\n' && FT_Get_Char_Index(ft_face_.get(), utf32_string[run_end]) != 0) {
+        ++run_end;
+    }
+    
+    std::vector<ShapedGlyph> shaped_glyphs = shapeString(utf32_string, index, run_end - index);
+    if (shaped_glyphs.empty()) return ofxBaseFont::appendGlyphData(utf32_string, index, glyph_list);
+    
+    std::vector<int> clusters;
+    clusters.reserve(shaped_glyphs.size());
+    for (auto &shaped_glyph : shaped_glyphs) {
+        clusters.push_back(shaped_glyph.cluster);
+    }
+    std::sort(clusters.begin(), clusters.end());
+    clusters.erase(std::unique(clusters.begin(), clusters.end()), clusters.end());
+    
+    for (auto &shaped_glyph : shaped_glyphs) {
+        auto next_cluster = std::upper_bound(clusters.begin(), clusters.end(), shaped_glyph.cluster);
+        int cluster_end = (next_cluster != clusters.end()) ? *next_cluster : run_end;
+        
+        ofxMixedFontUtil::ofxGlyphProps glyph_props;
+        glyph_props.code_point = utf32_string.substr(shaped_glyph.cluster, cluster_end - shaped_glyph.cluster);
+        glyph_props.glyph_id = shaped_glyph.glyph_id;
+        int glyph_index = getGlyphIndex(glyph_props);
+        
+        ofxMixedFontUtil::ofxGlyphData glyph = { shared_from_this(), loaded_glyphs_[glyph_index].props, ofPoint(0, 0), 0, 0 };
+        glyph.props.code_point = glyph_props.code_point;
+        glyph.string_index = shaped_glyph.cluster;
+        glyph.props.bearing_x += std::round(shaped_glyph.x_offset);
+        glyph.props.bearing_y += std::round(shaped_glyph.y_offset);
+        glyph.props.advance = std::round(shaped_glyph.x_advance);
+        glyph_list.push_back(glyph);
+    }
+    
+    return run_end - index;
+}
+
 void ofxFT2Font::drawGlyphs(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list)
 {
     if (!isReady()) return;
@@ -377,16 +1028,53 @@ void ofxFT2Font::drawGlyphsWithTexture(const std::vector<ofxMixedFontUtil::ofxGl
     if (!isReady()) return;
     if (!textureIsEnabled()) return;
     
-    bind();
+    if (is_batching_) {
+        if (!has_batched_quads_) {
+            string_quads_->clear();
+            batched_fonts_.push_back(std::static_pointer_cast<ofxFT2Font>(shared_from_this()));
+            has_batched_quads_ = true;
+        }
+        
+        // Note: batched quads carry the current color, since it may change before endBatch()
+        ofColor color = is_mono_font_ ? ofGetStyle().color : ofColor(255, 255, 255);
+        int first_vertex = string_quads_->getNumVertices();
+        for (auto &glyph : glyph_list) {
+            if (shared_from_this() == glyph.font.lock() && glyphIsVisible(glyph)) {
+                int glyph_index = getGlyphIndex(glyph.props);
+                int drawn_index = (glyph_index == -1) ? -1 : rasterizeGlyphOrNotDef(glyph_index);
+                if (drawn_index == -1) {
+                    continue;
+                }
+                addGlyphQuad(drawn_index, getGlyphOrigin(glyph, glyph_index));
+            }
+        }
+        
+        // Note: batched quads are moved by the current modelview matrix here, and endBatch() draws them under the identity matrix
+        const ofMatrix4x4 modelview_matrix = ofGetCurrentMatrix(OF_MATRIX_MODELVIEW);
+        const bool is_transformed = !modelview_matrix.isIdentity();
+        std::vector<ofVec3f> &vertices = string_quads_->getVertices();
+        for (int i = first_vertex; i < vertices.size(); ++i) {
+            if (is_transformed) {
+                vertices[i] = vertices[i] * modelview_matrix;
+            }
+            string_quads_->addColor(color);
+        }
+        return;
+    }
+    
+    // Note: Quads are made before bind(), so that it uploads the bitmaps (and subpixel variants) rasterized for them before they are drawn
+    string_quads_->clear();
     for (auto &glyph : glyph_list) {
-        if (shared_from_this() == glyph.font.lock()) {
-            int glyph_index = getGlyphIndex(glyph.props.code_point);
-            if (glyph_index == -1) {
+        if (shared_from_this() == glyph.font.lock() && glyphIsVisible(glyph)) {
+            int glyph_index = getGlyphIndex(glyph.props);
+            int drawn_index = (glyph_index == -1) ? -1 : rasterizeGlyphOrNotDef(glyph_index);
+            if (drawn_index == -1) {
                 continue;
             }
-            addCharQuad(glyph_index, glyph.coord);
+            addGlyphQuad(drawn_index, getGlyphOrigin(glyph, glyph_index));
         }
     }
+    bind();
     unbind();
 }
 
@@ -396,14 +1084,109 @@ void ofxFT2Font::drawGlyphsWithPath(const std::vector<ofxMixedFontUtil::ofxGlyph
     if (!pathIsEnabled()) return;
     
     for (auto &glyph : glyph_list) {
-        if (shared_from_this() == glyph.font.lock()) {
-            int glyph_index = getGlyphIndex(glyph.props.code_point);
-            if (glyph_index == -1) {
+        if (shared_from_this() == glyph.font.lock() && glyphIsVisible(glyph)) {
+            int glyph_index = getGlyphIndex(glyph.props);
+            if (glyph_index == -1 || loadGlyphOutline(glyph_index) != 0) {
                 continue;
             }
             loaded_glyph_outlines_[glyph_index].setFilled(false);
             loaded_glyph_outlines_[glyph_index].setStrokeWidth(0.5);
-            loaded_glyph_outlines_[glyph_index].draw(glyph.coord.x, glyph.coord.y);
+            const ofPoint origin = getGlyphOrigin(glyph, glyph_index);
+            loaded_glyph_outlines_[glyph_index].draw(origin.x, origin.y);
+        }
+    }
+}
+
+void ofxFT2Font::drawGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color)
+{
+    if (!isReady()) return;
+    
+    loadGlyphBitmaps(glyph_list);
+    drawLoadedGlyphsIntoPixels(glyph_list, pixels, offset, color, ofRectangle(0, 0, pixels.getWidth(), pixels.getHeight()));
+}
+
+void ofxFT2Font::loadGlyphBitmaps(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list)
+{
+    if (!isReady()) return;
+    
+    for (auto &glyph : glyph_list) {
+        if (shared_from_this() == glyph.font.lock()) {
+            rasterizeGlyphOrNotDef(getGlyphIndex(glyph.props));
+        }
+    }
+}
+
+void ofxFT2Font::drawLoadedGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color, const ofRectangle &region) const
+{
+    if (!isReady()) return;
+    if (pixels.getNumChannels() != 4) return;
+    
+    unsigned char premultiplied_color[4] = {
+        static_cast<unsigned char>(color.r * color.a / 255),
+        static_cast<unsigned char>(color.g * color.a / 255),
+        static_cast<unsigned char>(color.b * color.a / 255),
+        color.a
+    };
+    
+    const int atlas_width = atlas_pixels_->getWidth();
+    const int atlas_channels = atlas_pixels_->getNumChannels();
+    const unsigned char *atlas_data = atlas_pixels_->getData();
+    const int dst_width = pixels.getWidth();
+    const int region_left = std::max(0, static_cast<int>(region.getLeft()));
+    const int region_top = std::max(0, static_cast<int>(region.getTop()));
+    const int region_right = std::min(dst_width, static_cast<int>(region.getRight()));
+    const int region_bottom = std::min(static_cast<int>(pixels.getHeight()), static_cast<int>(region.getBottom()));
+    unsigned char *dst_data = pixels.getData();
+    std::vector<unsigned char> scaled_row;
+    
+    for (auto &glyph : glyph_list) {
+        if (shared_from_this() != glyph.font.lock()) {
+            continue;
+        }
+        int glyph_index = findGlyphIndex(glyph.props);
+        if (glyph_index == -1) {
+            continue;
+        }
+        int drawn_index = glyph_index;
+        if (loaded_glyph_states_[glyph_index] & GLYPH_BITMAP_FAILED) {
+            drawn_index = 0;
+        }
+        if (!(loaded_glyph_states_[drawn_index] & GLYPH_BITMAP_LOADED)) {
+            continue;
+        }
+        
+        const ofxMixedFontUtil::ofxGlyphData &entry = loaded_glyphs_[drawn_index];
+        const ofPoint origin = getGlyphOrigin(glyph, glyph_index);
+        int left = std::round(origin.x + offset.x + entry.props.bearing_x);
+        int top = std::round(origin.y + offset.y - entry.props.bearing_y);
+        int begin_x = std::max(region_left, left);
+        int end_x = std::min(region_right, left + entry.props.width);
+        int begin_y = std::max(region_top, top);
+        int end_y = std::min(region_bottom, top + entry.props.height);
+        if (begin_x >= end_x || begin_y >= end_y) {
+            continue;
+        }
+        
+        for (int y = begin_y; y < end_y; ++y) {
+            int atlas_y = entry.coord.y + static_cast<int>((y - top) / internal_scale_factor_);
+            const unsigned char *atlas_row = atlas_data + (atlas_y * atlas_width + static_cast<int>(entry.coord.x)) * atlas_channels;
+            unsigned char *dst_row = dst_data + (y * dst_width + begin_x) * 4;
+            
+            if (is_mono_font_) {
+                ofxMixedFontUtil::blendCoverageSpan(dst_row, atlas_row + (begin_x - left) * atlas_channels + 1, atlas_channels, end_x - begin_x, premultiplied_color);
+            }
+            else if (internal_scale_factor_ == 1.f) {
+                ofxMixedFontUtil::blendPremultipliedBGRASpan(dst_row, atlas_row + (begin_x - left) * 4, end_x - begin_x);
+            }
+            else {
+                // Note: bitmap strikes are resampled by nearest neighbor
+                scaled_row.resize((end_x - begin_x) * 4);
+                for (int x = begin_x; x < end_x; ++x) {
+                    const unsigned char *src = atlas_row + static_cast<int>((x - left) / internal_scale_factor_) * 4;
+                    std::copy(src, src + 4, &scaled_row[(x - begin_x) * 4]);
+                }
+                ofxMixedFontUtil::blendPremultipliedBGRASpan(dst_row, scaled_row.data(), end_x - begin_x);
+            }
         }
     }
 }
@@ -440,14 +1223,15 @@ static int pasteIntoAtlasPixels(const FT_Bitmap &bitmap, const bool is_mono_font
 
 static ofxMixedFontUtil::ofxGlyphData makeInternalGlyphData(const ofxMixedFontUtil::ofxGlyphProps &glyph_props, const ofPoint &coord)
 {
-    ofxMixedFontUtil::ofxGlyphData glyph = { std::weak_ptr<ofxMixedFontUtil::ofxBaseFont>(), glyph_props, coord };
+    ofxMixedFontUtil::ofxGlyphData glyph = { std::weak_ptr<ofxMixedFontUtil::ofxBaseFont>(), glyph_props, coord, 0, 0 };
     return glyph;
 }
 
-static ofxMixedFontUtil::ofxGlyphData makeInternalGlyphData(const float &inner_scale, const std::u32string &code_point, const FT_Glyph_Metrics &metrics, const ofPoint &coord)
+static ofxMixedFontUtil::ofxGlyphData makeInternalGlyphData(const float &inner_scale, const std::u32string &code_point, const int &glyph_id, const FT_Glyph_Metrics &metrics, const ofPoint &coord)
 {
     ofxMixedFontUtil::ofxGlyphProps glyph_props;
     glyph_props.code_point = code_point;
+    glyph_props.glyph_id = glyph_id;
     glyph_props.height = (metrics.height >> 6) * inner_scale;
     glyph_props.width = (metrics.width >> 6) * inner_scale;
     glyph_props.bearing_x = (metrics.horiBearingX >> 6) * inner_scale;
@@ -460,6 +1244,171 @@ static ofxMixedFontUtil::ofxGlyphData makeInternalGlyphData(const float &inner_s
     return makeInternalGlyphData(glyph_props, coord);
 }
 
+static ofxMixedFontUtil::ofxAtlasCacheHeader makeAtlasCacheKey(const std::shared_ptr<FT_LibraryRec_> &ft_library, const std::shared_ptr<ofxSharedFTFace> &shared_face, const float &font_size_pt, const bool &is_mono_font)
+{
+    ofxMixedFontUtil::ofxAtlasCacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    
+    FT_Int major = 0, minor = 0, patch = 0;
+    FT_Library_Version(ft_library.get(), &major, &minor, &patch);
+    header.font_hash = shared_face->blob->getTableHash();
+    header.font_file_size = shared_face->blob->getSize();
+    header.font_modification_time = shared_face->blob->getModificationTime();
+    header.face_index = shared_face->face->face_index;
+    header.font_size_pt = font_size_pt;
+    header.dpi = ofxMixedFontUtil::DPI;
+    header.load_flags = is_mono_font ? FT_LOAD_DEFAULT : FT_LOAD_COLOR;
+    header.render_mode = FT_RENDER_MODE_NORMAL;
+    header.freetype_version = major * 10000 + minor * 100 + patch;
+    
+    return header;
+}
+
+static bool atlasCacheKeyMatches(const ofxMixedFontUtil::ofxAtlasCacheHeader &lhs, const ofxMixedFontUtil::ofxAtlasCacheHeader &rhs)
+{
+    // Note: lhs is the cache file
+    return (lhs.font_hash == rhs.font_hash && lhs.font_file_size == rhs.font_file_size
+            && (lhs.font_modification_time == 0 || lhs.font_modification_time == rhs.font_modification_time) && lhs.face_index == rhs.face_index && lhs.font_size_pt == rhs.font_size_pt && lhs.dpi == rhs.dpi
+            && lhs.load_flags == rhs.load_flags && lhs.render_mode == rhs.render_mode && lhs.freetype_version == rhs.freetype_version);
+}
+
+int ofxFT2Font::saveAtlasCache(const std::string &cache_file_name) const
+{
+    if (!isReady()) return -1;
+    
+    ofxMixedFontUtil::ofxAtlasCacheHeader header = makeAtlasCacheKey(ft_library_, shared_face_, font_props_.font_size_pt, is_mono_font_);
+    header.internal_scale_factor = internal_scale_factor_;
+    header.atlas_width = atlas_pixels_->getWidth();
+    header.atlas_height = next_atlas_offset_y_; // Note: rows below it are empty
+    header.atlas_channels = atlas_pixels_->getNumChannels();
+    header.atlas_offset_x = atlas_offset_x_;
+    header.atlas_offset_y = atlas_offset_y_;
+    header.next_atlas_offset_y = next_atlas_offset_y_;
+    
+    std::u32string code_points;
+    std::vector<ofxMixedFontUtil::ofxAtlasCacheGlyph> glyphs;
+    glyphs.reserve(loaded_glyphs_.size());
+    for (std::size_t i = 0; i < loaded_glyphs_.size(); ++i) {
+        const ofxMixedFontUtil::ofxGlyphData &glyph_data = loaded_glyphs_[i];
+        ofxMixedFontUtil::ofxAtlasCacheGlyph glyph;
+        glyph.glyph_id = loaded_glyph_ids_[i];
+        glyph.width = glyph_data.props.width;
+        glyph.height = glyph_data.props.height;
+        glyph.bearing_x = glyph_data.props.bearing_x;
+        glyph.bearing_y = glyph_data.props.bearing_y;
+        glyph.advance = glyph_data.props.advance;
+        glyph.vertical_bearing_x = glyph_data.props.vertical_bearing_x;
+        glyph.vertical_bearing_y = glyph_data.props.vertical_bearing_y;
+        glyph.vertical_advance = glyph_data.props.vertical_advance;
+        glyph.atlas_x = glyph_data.coord.x;
+        glyph.atlas_y = glyph_data.coord.y;
+        glyph.state = (loaded_glyph_states_[i] & GLYPH_BITMAP_LOADED) ? ofxMixedFontUtil::ATLAS_CACHE_GLYPH_BITMAP : 0;
+        glyph.code_point_begin = code_points.length();
+        glyph.code_point_length = glyph_data.props.code_point.length();
+        code_points += glyph_data.props.code_point;
+        glyphs.push_back(glyph);
+    }
+    
+    std::vector<ofxMixedFontUtil::ofxAtlasCacheSequence> sequences;
+    sequences.reserve(sequence_indices_.size());
+    for (auto &entry : sequence_indices_) {
+        ofxMixedFontUtil::ofxAtlasCacheSequence sequence;
+        sequence.code_point_begin = code_points.length();
+        sequence.code_point_length = entry.first.length();
+        sequence.glyph_index = entry.second;
+        code_points += entry.first;
+        sequences.push_back(sequence);
+    }
+    
+    int err = ofxMixedFontUtil::writeAtlasCache(ofToDataPath(cache_file_name, true), header, glyphs, sequences, code_points, atlas_pixels_->getData());
+    if (err) {
+        ofLogError("ofxFT2Font") << "saveAtlasCache(): couldn't write \"" << cache_file_name << "\": error " << err;
+        return -2;
+    }
+    
+    return 0;
+}
+
+int ofxFT2Font::loadAtlasCache(const std::string &cache_file_name)
+{
+    if (!isReady()) return -1;
+    
+    std::string cache_file_path = ofToDataPath(cache_file_name, true);
+    if (!ofFile(cache_file_path, ofFile::Reference).exists()) {
+        return -2;
+    }
+    
+    // Note: The file is mapped only while it is copied into the atlas
+    std::shared_ptr<const ofxMixedFontUtil::ofxFontBlob> cache = ofxMixedFontUtil::ofxFontBlob::open(cache_file_path);
+    ofxMixedFontUtil::ofxAtlasCacheView view;
+    if (!cache || ofxMixedFontUtil::readAtlasCache(cache->getData(), cache->getSize(), view) != 0) {
+        ofLogError("ofxFT2Font") << "loadAtlasCache(): \"" << cache_file_name << "\" is broken or of another version";
+        return -3;
+    }
+    
+    const ofxMixedFontUtil::ofxAtlasCacheHeader &header = *view.header;
+    if (!atlasCacheKeyMatches(header, makeAtlasCacheKey(ft_library_, shared_face_, font_props_.font_size_pt, is_mono_font_))
+        || header.atlas_width != atlas_pixels_->getWidth() || header.atlas_height > atlas_pixels_->getHeight()
+        || header.atlas_channels != atlas_pixels_->getNumChannels() || header.glyph_count == 0 || header.internal_scale_factor != internal_scale_factor_
+        || header.atlas_offset_x < 0 || header.atlas_offset_x > header.atlas_width || header.atlas_offset_y < 0
+        || header.atlas_offset_y > header.next_atlas_offset_y || header.next_atlas_offset_y > header.atlas_height) {
+        ofLogNotice("ofxFT2Font") << "loadAtlasCache(): \"" << cache_file_name << "\" was made for another font or setting";
+        return -4;
+    }
+    
+    loaded_glyphs_.clear();
+    loaded_glyph_outlines_.clear();
+    loaded_glyph_ids_.clear();
+    loaded_glyph_states_.clear();
+    glyph_id_indices_.clear();
+    sequence_indices_.clear();
+    subpixel_variants_.clear();
+    subpixel_variant_indices_.clear();
+    
+    loaded_glyphs_.reserve(header.glyph_count);
+    for (std::uint32_t i = 0; i < header.glyph_count; ++i) {
+        const ofxMixedFontUtil::ofxAtlasCacheGlyph &glyph = view.glyphs[i];
+        ofxMixedFontUtil::ofxGlyphProps glyph_props;
+        glyph_props.code_point.assign(view.code_points + glyph.code_point_begin, glyph.code_point_length);
+        glyph_props.glyph_id = glyph.glyph_id;
+        glyph_props.width = glyph.width;
+        glyph_props.height = glyph.height;
+        glyph_props.bearing_x = glyph.bearing_x;
+        glyph_props.bearing_y = glyph.bearing_y;
+        glyph_props.advance = glyph.advance;
+        glyph_props.vertical_bearing_x = glyph.vertical_bearing_x;
+        glyph_props.vertical_bearing_y = glyph.vertical_bearing_y;
+        glyph_props.vertical_advance = glyph.vertical_advance;
+        
+        loaded_glyphs_.push_back(makeInternalGlyphData(glyph_props, ofPoint(glyph.atlas_x, glyph.atlas_y)));
+        loaded_glyph_ids_.push_back(glyph.glyph_id);
+        if (glyph.glyph_id < 0) { // Note: space glyphs made by makeSpaceGlyphProps()
+            loaded_glyph_states_.push_back(GLYPH_BITMAP_LOADED | GLYPH_OUTLINE_LOADED);
+        }
+        else {
+            loaded_glyph_states_.push_back((glyph.state & ofxMixedFontUtil::ATLAS_CACHE_GLYPH_BITMAP) ? GLYPH_BITMAP_LOADED : GLYPH_METRICS_LOADED);
+            glyph_id_indices_.emplace(glyph.glyph_id, i);
+        }
+        if (pathIsEnabled()) {
+            loaded_glyph_outlines_.push_back(ofPath());
+        }
+    }
+    for (std::uint32_t i = 0; i < header.sequence_count; ++i) {
+        const ofxMixedFontUtil::ofxAtlasCacheSequence &sequence = view.sequences[i];
+        sequence_indices_[std::u32string(view.code_points + sequence.code_point_begin, sequence.code_point_length)] = sequence.glyph_index;
+    }
+    
+    std::memcpy(atlas_pixels_->getData(), view.pixels, static_cast<std::size_t>(header.atlas_width) * header.atlas_height * header.atlas_channels);
+    atlas_offset_x_ = header.atlas_offset_x;
+    atlas_offset_y_ = header.atlas_offset_y;
+    next_atlas_offset_y_ = header.next_atlas_offset_y;
+    atlas_pixels_have_been_updated_ = true;
+    ++load_generation_;
+    clearTypesetCache();
+    
+    return 0;
+}
+
 void ofxFT2Font::drawString(const std::u32string &utf32_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func)
 {
     if (!isReady()) return;
@@ -476,8 +1425,14 @@ void ofxFT2Font::drawString(const std::u32string &utf32_string, const ofPoint &c
 
 ofTexture ofxFT2Font::getStringAsTexture(const std::u32string &utf32_string, const ofxMixedFontUtil::ofxCompFunc &func)
 {
-    // if (!isReady()) return;
-    return ofTexture();
+    ofTexture texture;
+    
+    ofPixels pixels = getStringAsPixels(utf32_string, func);
+    if (pixels.isAllocated()) {
+        texture.allocate(pixels);
+    }
+    
+    return texture;
 }
 
 std::vector<ofPath> ofxFT2Font::getStringAsPath(const std::u32string &utf32_string, const ofxMixedFontUtil::ofxCompFunc &func)
@@ -486,10 +1441,11 @@ std::vector<ofPath> ofxFT2Font::getStringAsPath(const std::u32string &utf32_stri
     
     if (isReady()) {
         if (pathIsEnabled()) {
-            std::vector<ofxMixedFontUtil::ofxGlyphData> glyph_list = typesetString(utf32_string, ofPoint(0, 0), func);
-            for (auto &glyph : glyph_list) {
-                int glyph_index = getGlyphIndex(glyph.props.code_point);
-                if (glyph_index == -1) {
+            ScopedTypesetBuffer buffer(typeset_buffer_);
+            typesetString(utf32_string, ofPoint(0, 0), buffer.glyphs, func);
+            for (auto &glyph : buffer.glyphs) {
+                int glyph_index = getGlyphIndex(glyph.props);
+                if (glyph_index == -1 || loadGlyphOutline(glyph_index) != 0) {
                     continue;
                 }
                 outlines.push_back(loaded_glyph_outlines_[glyph_index]);
@@ -502,61 +1458,259 @@ std::vector<ofPath> ofxFT2Font::getStringAsPath(const std::u32string &utf32_stri
 
 int ofxFT2Font::getGlyphIndex(const std::u32string &code_point)
 {
-    int index = 0;
-    for (; index != loaded_glyphs_.size(); ++index) {
-        if (loaded_glyphs_[index].props.code_point == code_point) {
-            return index;
-        }
+    auto found = sequence_indices_.find(code_point);
+    if (found != sequence_indices_.end()) {
+        return found->second;
     }
     
-    if (index == loaded_glyphs_.size()) {
-        index = loadGlyph(code_point);
-        if (index == -1) { // Glyph is not found
-            index = 0; // glyph index of sub character
-        }
+    int index = loadGlyph(code_point);
+    if (index < 0) { // Glyph is not found
+        index = 0; // glyph index of sub character
     }
+    sequence_indices_[code_point] = index;
     
     return index;
 }
 
+int ofxFT2Font::getGlyphIndex(const ofxMixedFontUtil::ofxGlyphProps &glyph_props)
+{
+    if (glyph_props.glyph_id < 0) {
+        return getGlyphIndex(glyph_props.code_point);
+    }
+    
+    auto found = glyph_id_indices_.find(glyph_props.glyph_id);
+    if (found != glyph_id_indices_.end()) {
+        return found->second;
+    }
+    
+    int index = loadGlyphById(glyph_props.glyph_id, glyph_props.code_point);
+    return (index < 0) ? 0 : index;
+}
+
+int ofxFT2Font::findGlyphIndex(const std::u32string &code_point) const
+{
+    auto found = sequence_indices_.find(code_point);
+    return (found != sequence_indices_.end()) ? found->second : -1;
+}
+
+int ofxFT2Font::findGlyphIndex(const ofxMixedFontUtil::ofxGlyphProps &glyph_props) const
+{
+    if (glyph_props.glyph_id < 0) {
+        return findGlyphIndex(glyph_props.code_point);
+    }
+    
+    auto found = glyph_id_indices_.find(glyph_props.glyph_id);
+    return (found != glyph_id_indices_.end()) ? found->second : -1;
+}
+
 int ofxFT2Font::loadGlyph(const u32string &code_point, bool try_load_sub)
 {
     std::u32string tmp_code_point = { code_point[0] };
     
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
     FT_UInt gid = (try_load_sub) ? 0 : FT_Get_Char_Index(ft_face_.get(), tmp_code_point[0]);
     if (!try_load_sub && gid ==0) {
         return 0;
     }
     
+    auto found = glyph_id_indices_.find(gid);
+    if (found != glyph_id_indices_.end()) {
+        return found->second;
+    }
+    
+    return loadGlyphById(gid, tmp_code_point);
+}
+
+int ofxFT2Font::loadGlyphById(const int &glyph_id, const std::u32string &code_point)
+{
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
     FT_Int32 load_flags = is_mono_font_ ? FT_LOAD_DEFAULT : FT_LOAD_COLOR;
-    FT_Error err = FT_Load_Glyph(ft_face_.get(), gid, load_flags);
+    FT_Error err = FT_Load_Glyph(ft_face_.get(), glyph_id, load_flags);
     if (err) {
-        // ofLogError("ofxFT2Font") << "loadGlyph(): error with FT_Load_Glyph \"" << code_point << "\": FT_Error " << err;
+        // ofLogError("ofxFT2Font") << "loadGlyphById(): error with FT_Load_Glyph \"" << glyph_id << "\": FT_Error " << err;
         return -2; // This font doesn't have .notdef glyph
     }
     
+    // Note: The bitmap and the outline are loaded on demand by rasterizeGlyph() and loadGlyphOutline()
+    loaded_glyphs_.push_back(makeInternalGlyphData(internal_scale_factor_, code_point, glyph_id, ft_face_->glyph->metrics, ofPoint(0, 0)));
+    loaded_glyph_ids_.push_back(glyph_id);
+    loaded_glyph_states_.push_back(GLYPH_METRICS_LOADED);
+    if (pathIsEnabled()) {
+        loaded_glyph_outlines_.push_back(ofPath());
+    }
+    glyph_id_indices_[glyph_id] = loaded_glyphs_.size() - 1;
+    
+    return loaded_glyphs_.size() - 1;
+}
+
+static bool IsVariationSelector(const char32_t &code_point)
+{
+    return ((0xFE00 <= code_point && code_point <= 0xFE0F) || (0xE0100 <= code_point && code_point <= 0xE01EF));
+}
+
+int ofxFT2Font::getSequenceGlyphIndex(const std::u32string &sequence)
+{
+    auto found = sequence_indices_.find(sequence);
+    if (found != sequence_indices_.end()) {
+        return found->second;
+    }
+    
+    std::u32string base_sequence;
+    char32_t variation_selector = 0;
+    for (auto &code_point : sequence) {
+        if (IsVariationSelector(code_point)) {
+            variation_selector = code_point;
+        }
+        else {
+            base_sequence.push_back(code_point);
+        }
+    }
+    
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+    int glyph_id = 0;
+    if (variation_selector == U'\uFE0F' && is_mono_font_) {
+        // Note: Emoji presentation is left to color fonts, so that ofxMixedFont can choose one of them
+    }
+    else if (base_sequence.length() == 1) {
+        glyph_id = FT_Face_GetCharVariantIndex(ft_face_.get(), base_sequence[0], variation_selector);
+        if (glyph_id == 0) {
+            glyph_id = FT_Get_Char_Index(ft_face_.get(), base_sequence[0]);
+        }
+    }
+    else if (base_sequence.length() > 1) {
+        // Note: Ligatures are looked up by HarfBuzz, with and without variation selectors
+        std::vector<ShapedGlyph> shaped_glyphs = shapeString(base_sequence, 0, base_sequence.length());
+        if (shaped_glyphs.size() != 1 && variation_selector != 0) {
+            shaped_glyphs = shapeString(sequence, 0, sequence.length());
+        }
+        if (shaped_glyphs.size() == 1) {
+            glyph_id = shaped_glyphs[0].glyph_id;
+        }
+    }
+    
+    int index = 0;
+    if (glyph_id > 0) {
+        auto found_id = glyph_id_indices_.find(glyph_id);
+        index = (found_id != glyph_id_indices_.end()) ? found_id->second : std::max(0, loadGlyphById(glyph_id, sequence));
+    }
+    sequence_indices_[sequence] = index;
+    
+    return index;
+}
+
+int ofxFT2Font::rasterizeGlyph(const int &glyph_index)
+{
+    if (glyph_index < 0 || loaded_glyphs_.size() <= glyph_index) {
+        return -1;
+    }
+    if (loaded_glyph_states_[glyph_index] & GLYPH_BITMAP_LOADED) {
+        return 0;
+    }
+    if (loaded_glyph_states_[glyph_index] & GLYPH_BITMAP_FAILED) {
+        return -1;
+    }
+    
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+    FT_Int32 load_flags = is_mono_font_ ? FT_LOAD_DEFAULT : FT_LOAD_COLOR;
+    FT_Error err = FT_Load_Glyph(ft_face_.get(), loaded_glyph_ids_[glyph_index], load_flags);
+    if (err) {
+        loaded_glyph_states_[glyph_index] |= GLYPH_BITMAP_FAILED;
+        return -2;
+    }
+    
     FT_Render_Glyph(ft_face_->glyph, FT_RENDER_MODE_NORMAL);
     FT_Bitmap &bitmap = ft_face_->glyph->bitmap;
     if (pasteIntoAtlasPixels(bitmap, is_mono_font_, atlas_pixels_, atlas_offset_x_, atlas_offset_y_, next_atlas_offset_y_) != 0) {
-        ofLogError("ofxFT2Font") << "loadGlyph(): atlas texture has been full";
+        ofLogError("ofxFT2Font") << "rasterizeGlyph(): atlas texture has been full";
+        loaded_glyph_states_[glyph_index] |= GLYPH_BITMAP_FAILED; // Note: It is drawn as .notdef from now on, instead of trying again every frame
         return -1;
     }
-    loaded_glyphs_.push_back(makeInternalGlyphData(internal_scale_factor_, tmp_code_point, ft_face_->glyph->metrics, ofPoint(atlas_offset_x_, atlas_offset_y_)));
+    loaded_glyphs_[glyph_index].coord.set(atlas_offset_x_, atlas_offset_y_);
+    loaded_glyph_states_[glyph_index] |= GLYPH_BITMAP_LOADED;
     atlas_pixels_have_been_updated_ = true;
     atlas_offset_x_ += bitmap.width + 1;
     
-    if (pathIsEnabled()) {
-        FT_Outline &outline = ft_face_->glyph->outline;
-        loaded_glyph_outlines_.push_back(makeContoursForCharacter(outline));
+    return 0;
+}
+
+int ofxFT2Font::rasterizeGlyphOrNotDef(const int &glyph_index)
+{
+    if (rasterizeGlyph(glyph_index) == 0) {
+        return glyph_index;
     }
     
-    return loaded_glyphs_.size() - 1;
+    return (glyph_index > 0 && rasterizeGlyph(0) == 0) ? 0 : -1;
+}
+
+int ofxFT2Font::rasterizeSubpixelVariant(const int &glyph_index, const int &phase)
+{
+    if (glyph_index < 0 || loaded_glyphs_.size() <= glyph_index || loaded_glyph_ids_[glyph_index] < 0) {
+        return -1;
+    }
+    
+    unsigned long long key = (static_cast<unsigned long long>(glyph_index) << 8) | phase;
+    auto found = subpixel_variant_indices_.find(key);
+    if (found != subpixel_variant_indices_.end()) {
+        return found->second;
+    }
+    
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+    FT_Error err = FT_Load_Glyph(ft_face_.get(), loaded_glyph_ids_[glyph_index], FT_LOAD_DEFAULT);
+    if (err || ft_face_->glyph->format != FT_GLYPH_FORMAT_OUTLINE) {
+        subpixel_variant_indices_[key] = -1;
+        return -1;
+    }
+    
+    // Note: 26.6 fixed point, so 64 is one pixel
+    FT_Outline_Translate(&ft_face_->glyph->outline, 64 * phase / subpixel_phase_count_, 0);
+    FT_Render_Glyph(ft_face_->glyph, FT_RENDER_MODE_NORMAL);
+    FT_Bitmap &bitmap = ft_face_->glyph->bitmap;
+    if (pasteIntoAtlasPixels(bitmap, is_mono_font_, atlas_pixels_, atlas_offset_x_, atlas_offset_y_, next_atlas_offset_y_) != 0) {
+        ofLogError("ofxFT2Font") << "rasterizeSubpixelVariant(): atlas texture has been full";
+        subpixel_variant_indices_[key] = -1; // Note: The base glyph is drawn from now on, instead of trying again every frame
+        return -1;
+    }
+    
+    ofxMixedFontUtil::ofxGlyphData variant = loaded_glyphs_[glyph_index];
+    variant.props.width = bitmap.width;
+    variant.props.height = bitmap.rows;
+    variant.props.bearing_x = ft_face_->glyph->bitmap_left;
+    variant.props.bearing_y = ft_face_->glyph->bitmap_top;
+    variant.coord.set(atlas_offset_x_, atlas_offset_y_);
+    subpixel_variants_.push_back(variant);
+    subpixel_variant_indices_[key] = subpixel_variants_.size() - 1;
+    atlas_pixels_have_been_updated_ = true;
+    atlas_offset_x_ += bitmap.width + 1;
+    
+    return subpixel_variants_.size() - 1;
+}
+
+int ofxFT2Font::loadGlyphOutline(const int &glyph_index)
+{
+    if (glyph_index < 0 || loaded_glyphs_.size() <= glyph_index || !pathIsEnabled()) {
+        return -1;
+    }
+    if (loaded_glyph_states_[glyph_index] & GLYPH_OUTLINE_LOADED) {
+        return 0;
+    }
+    
+    std::unique_lock<std::recursive_mutex> face_lock = lockFace();
+    FT_Error err = FT_Load_Glyph(ft_face_.get(), loaded_glyph_ids_[glyph_index], FT_LOAD_DEFAULT);
+    if (err) {
+        return -2;
+    }
+    
+    loaded_glyph_outlines_[glyph_index] = makeContoursForCharacter(ft_face_->glyph->outline);
+    loaded_glyph_states_[glyph_index] |= GLYPH_OUTLINE_LOADED;
+    
+    return 0;
 }
 
 int ofxFT2Font::makeSpaceGlyphProps(const char32_t &code_point, const float &scale)
 {
     ofxMixedFontUtil::ofxGlyphProps glyph_props;
     glyph_props.code_point = code_point;
+    glyph_props.glyph_id = -1;
     glyph_props.width = 0;
     glyph_props.height = 0;
     glyph_props.bearing_x = 0;
@@ -567,9 +1721,12 @@ int ofxFT2Font::makeSpaceGlyphProps(const char32_t &code_point, const float &sca
     glyph_props.vertical_advance = font_props_.y_ppem * scale;
 
     loaded_glyphs_.push_back(makeInternalGlyphData(glyph_props, ofPoint(0, 0)));
+    loaded_glyph_ids_.push_back(-1);
+    loaded_glyph_states_.push_back(GLYPH_BITMAP_LOADED | GLYPH_OUTLINE_LOADED);
     if (pathIsEnabled()) {
         loaded_glyph_outlines_.push_back(ofPath());
     }
+    sequence_indices_[glyph_props.code_point] = loaded_glyphs_.size() - 1;
 
     return 0;
 }
@@ -597,45 +1754,90 @@ int ofxFT2Font::setLineFeedGlyphProps()
 void ofxFT2Font::bind()
 {
     if (!is_mono_font_) {
-        color_.reset(new ofColor(ofGetStyle().color));
-        ofSetColor(255, 255, 255);
+        const ofColor &current_color = ofGetStyle().color;
+        if (current_color.r != 255 || current_color.g != 255 || current_color.b != 255) {
+            color_.reset(new ofColor(current_color));
+            ofSetColor(255, 255, 255);
+        }
+        else {
+            color_.reset();
+        }
     }
     
     GLenum format = is_mono_font_ ? GL_LUMINANCE_ALPHA : GL_BGRA;
     GLenum sfactor = is_mono_font_ ? GL_BLEND_SRC : GL_ONE;
     
     if (atlas_pixels_have_been_updated_) {
+        if (atlas_texture_needs_allocation_ || !atlas_texture_->isAllocated()) {
+            atlas_texture_->allocate(*atlas_pixels_);
+            atlas_texture_needs_allocation_ = false;
+        }
         atlas_texture_->loadData(*atlas_pixels_, format);
         atlas_texture_->setTextureMinMagFilter(GL_LINEAR, GL_LINEAR);
         atlas_pixels_have_been_updated_ = false;
     }
     
-    blend_is_enabled_ = glIsEnabled(GL_BLEND);
-    glGetIntegerv(GL_BLEND_SRC, &blend_src_);
-    glGetIntegerv(GL_BLEND_DST, &blend_dst_);
-    
-    glEnable(GL_BLEND);
-    glBlendFunc(sfactor, GL_ONE_MINUS_SRC_ALPHA);
+    if (render_state_depth_ > 0) {
+        if (render_state_current_sfactor_ != sfactor) {
+            if (render_state_current_sfactor_ == -1) {
+                glEnable(GL_BLEND);
+            }
+            glBlendFunc(sfactor, GL_ONE_MINUS_SRC_ALPHA);
+            render_state_current_sfactor_ = sfactor;
+        }
+    }
+    else {
+        blend_is_enabled_ = glIsEnabled(GL_BLEND);
+        glGetIntegerv(GL_BLEND_SRC, &blend_src_);
+        glGetIntegerv(GL_BLEND_DST, &blend_dst_);
+        
+        glEnable(GL_BLEND);
+        glBlendFunc(sfactor, GL_ONE_MINUS_SRC_ALPHA);
+    }
     
     atlas_texture_->bind();
-    string_quads_->clear();
 }
 
-void ofxFT2Font::addCharQuad(const int &glyph_index, const ofPoint &coord)
+ofPoint ofxFT2Font::getGlyphOrigin(const ofxMixedFontUtil::ofxGlyphData &glyph, const int &glyph_index) const
+{
+    // Note: Shaped glyphs carry the HarfBuzz offsets in their bearings, as differences from the bearings of the loaded glyph
+    const ofxMixedFontUtil::ofxGlyphProps &props = loaded_glyphs_[glyph_index].props;
+    return ofPoint(glyph.coord.x + glyph.props.bearing_x - props.bearing_x, glyph.coord.y - glyph.props.bearing_y + props.bearing_y, glyph.coord.z);
+}
+
+void ofxFT2Font::addGlyphQuad(const int &glyph_index, const ofPoint &coord)
 {
     if (glyph_index < 0 || loaded_glyphs_.size() <= glyph_index) {
         return;
     }
+    if (subpixel_phase_count_ <= 1 || !is_mono_font_) {
+        addCharQuad(loaded_glyphs_[glyph_index], coord);
+        return;
+    }
     
-    GLfloat	t2 = loaded_glyphs_[glyph_index].coord.x;
-    GLfloat	v2 = loaded_glyphs_[glyph_index].coord.y;
-    GLfloat	t1 = t2 + loaded_glyphs_[glyph_index].props.width / internal_scale_factor_;
-    GLfloat	v1 = v2 + loaded_glyphs_[glyph_index].props.height / internal_scale_factor_;
+    // Note: The quad is snapped to the pixel grid, and the fraction of x is drawn by the bitmap of the nearest phase
+    float x = std::floor(coord.x);
+    int phase = std::round((coord.x - x) * subpixel_phase_count_);
+    if (phase == subpixel_phase_count_) {
+        x += 1.f;
+        phase = 0;
+    }
+    const int variant_index = (phase > 0) ? rasterizeSubpixelVariant(glyph_index, phase) : -1;
+    const ofxMixedFontUtil::ofxGlyphData &entry = (variant_index >= 0) ? subpixel_variants_[variant_index] : loaded_glyphs_[glyph_index];
+    addCharQuad(entry, ofPoint(x, std::round(coord.y)));
+}
+
+void ofxFT2Font::addCharQuad(const ofxMixedFontUtil::ofxGlyphData &entry, const ofPoint &coord)
+{
+    GLfloat	t2 = entry.coord.x;
+    GLfloat	v2 = entry.coord.y;
+    GLfloat	t1 = t2 + entry.props.width / internal_scale_factor_;
+    GLfloat	v1 = v2 + entry.props.height / internal_scale_factor_;
     
-    GLfloat	x2 = coord.x + loaded_glyphs_[glyph_index].props.bearing_x;
-    GLfloat	y2 = coord.y - loaded_glyphs_[glyph_index].props.bearing_y;
-    GLfloat	x1 = x2 + loaded_glyphs_[glyph_index].props.width;
-    GLfloat	y1 = y2 + loaded_glyphs_[glyph_index].props.height;
+    GLfloat	x2 = coord.x + entry.props.bearing_x;
+    GLfloat	y2 = coord.y - entry.props.bearing_y;
+    GLfloat	x1 = x2 + entry.props.width;
+    GLfloat	y1 = y2 + entry.props.height;
     
     int firstIndex = string_quads_->getVertices().size();
     
@@ -662,11 +1864,13 @@ void ofxFT2Font::unbind()
     string_quads_->drawFaces();
     atlas_texture_->unbind();
     
-    if(!blend_is_enabled_){
-        glDisable(GL_BLEND);
+    if (render_state_depth_ == 0) {
+        if(!blend_is_enabled_){
+            glDisable(GL_BLEND);
+        }
+        glBlendFunc(blend_src_, blend_dst_);
     }
-    glBlendFunc(blend_src_, blend_dst_);
-    if (!is_mono_font_) {
+    if (!is_mono_font_ && color_) {
         ofSetColor(*color_);
     }
 }
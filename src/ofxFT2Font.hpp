@@ -2,7 +2,13 @@
 
 #include "ofxMixedFontUtil.hpp"
 
+#include <unordered_map>
+#include <mutex>
+#include <future>
+
 struct FT_FaceRec_;
+struct FT_SizeRec_;
+struct ofxSharedFTFace;
 struct FT_LibraryRec_;
 class ofTexture;
 class ofPath;
@@ -16,23 +22,89 @@ class ofxFT2Font : public ofxMixedFontUtil::ofxBaseFont
 {
 public:
     ofxFT2Font();
-    ofxFT2Font(const std::string &file_name, float font_size_pt);
-    virtual ~ofxFT2Font() {};
+    ofxFT2Font(const std::string &file_name, float font_size_pt, int face_index = 0);
+    virtual ~ofxFT2Font();
     
     ofxFT2Font(const ofxFT2Font &) = delete;
     ofxFT2Font(ofxFT2Font &&) = delete;
     ofxFT2Font &operator=(const ofxFT2Font &) = delete;
     ofxFT2Font &operator=(ofxFT2Font &&) = delete;
     
-    int initialize(const std::string &file_name, float font_size_pt);
+    // Note: face_index selects a member of a font collection (.ttc, .otc). Members of the same collection share one mapped file.
+    int initialize(const std::string &file_name, float font_size_pt, int face_index = 0);
+    // Note: Runs initialize() on a background thread, and the font becomes ready when it has finished.
+    //       The atlas texture is allocated on the first draw on the GL thread, and the destructor waits for the loading thread.
+    std::shared_future<int> loadAsync(const std::string &file_name, float font_size_pt, int face_index = 0);
     int reset();
     enum DrawingMode { TEXTURE_MODE, PATH_MODE };
     bool selectDrawingMode(const DrawingMode &drawing_mode);
     
+    enum ShapingDirection { DIRECTION_AUTO, DIRECTION_LTR, DIRECTION_RTL };
+    struct ShapingOptions {
+        std::string script; // Note: ISO 15924 tag (ex. "Arab"), or empty to guess it from the text
+        std::string language; // Note: BCP 47 tag (ex. "ja"), or empty to guess it from the locale
+        ShapingDirection direction = DIRECTION_AUTO;
+        std::vector<std::string> features; // Note: HarfBuzz feature strings (ex. "-liga", "ss01")
+    };
+    struct ShapedGlyph {
+        int glyph_id;
+        int cluster;
+        float x_advance;
+        float y_advance;
+        float x_offset;
+        float y_offset;
+    };
+    bool setKerningEnabled(const bool &is_enabled);
+    bool kerningIsEnabled() const;
+    int getKerning(const int &left_glyph_id, const int &right_glyph_id);
+    int preloadGlyphs(const std::u32string &utf32_characters);
+    
+    // Note: With 2-4 phases, glyphs drawn with texture at a fractional x are rasterized at the nearest horizontal phase offset.
+    //       Each (glyph, phase) pair takes its own atlas entry, which is made on first use. 1 disables it. (Outline fonts only)
+    bool setSubpixelPhaseCount(const int &phase_count);
+    int getSubpixelPhaseCount() const;
+    
+    // Note: Saves the atlas and the metrics of loaded glyphs, so that the next launch can skip FreeType for them.
+    //       loadAtlasCache() uses the file only if it was made from the same font file, size, DPI and FreeType version.
+    //       It returns -2 if the file doesn't exist. The atlas is uploaded to the GPU on the next draw.
+    int saveAtlasCache(const std::string &cache_file_name) const;
+    int loadAtlasCache(const std::string &cache_file_name);
+    
+    static bool shapingIsAvailable();
+    bool setShapingEnabled(const bool &is_enabled);
+    bool shapingIsEnabled() const;
+    void setShapingOptions(const ShapingOptions &options);
+    ShapingOptions getShapingOptions() const;
+    std::vector<ShapedGlyph> shapeString(const std::u32string &utf32_string, const int &index, const int &length);
+    
+    static void beginRenderState();
+    static void endRenderState();
+    
+    class ScopedRenderState
+    {
+    public:
+        ScopedRenderState() { ofxFT2Font::beginRenderState(); };
+        ~ScopedRenderState() { ofxFT2Font::endRenderState(); };
+        
+        ScopedRenderState(const ScopedRenderState &) = delete;
+        ScopedRenderState &operator=(const ScopedRenderState &) = delete;
+    };
+    
+    // Note: Between beginBatch() and endBatch(), drawing with texture only appends quads.
+    //       endBatch() draws them with one bind per font, so strings of different fonts may overlap in a different order.
+    //       Quads keep the modelview matrix of each draw, and subpixel phases are chosen in string coordinates as in immediate drawing.
+    static void beginBatch();
+    static void endBatch();
+    static bool isBatching();
+    
     ofxMixedFontUtil::ofxGlyphData makeGlyphData(const std::u32string &utf32_character, const int &index, int &length) override;
+    int appendGlyphData(const std::u32string &utf32_string, const int &index, std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
     void drawGlyphs(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
     void drawGlyphsWithTexture(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
     void drawGlyphsWithPath(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
+    void drawGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color) override;
+    void loadGlyphBitmaps(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
+    void drawLoadedGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color, const ofRectangle &region) const override;
     
     void drawString(const std::u32string &utf32_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func = ofxMixedFontUtil::defaultCompFunc) override;
     ofTexture getStringAsTexture(const std::u32string &utf32_string, const ofxMixedFontUtil::ofxCompFunc &func = ofxMixedFontUtil::defaultCompFunc) override;
@@ -50,33 +122,90 @@ public:
     using ofxBaseFont::getGlyphBoundingBoxes;
     using ofxBaseFont::getStringAsTexture;
     using ofxBaseFont::getStringAsPath;
+    using ofxBaseFont::getStringAsPixels;
+    using ofxBaseFont::setTypesetCacheCapacity;
+    using ofxBaseFont::clearTypesetCache;
+    using ofxBaseFont::getTypesetCacheStats;
+    using ofxBaseFont::typesetString;
+    using ofxBaseFont::setBaseDirection;
+    using ofxBaseFont::getBaseDirection;
+    using ofxBaseFont::fitString;
+    using ofxBaseFont::fitStrings;
+    std::size_t getTypesetConfigHash() const override;
     
 protected:
     int setNotDefGlyphProps() override;
     int setSpaceGlyphProps() override;
     int setFullWidthSpaceGlyphProps() override;
     int setLineFeedGlyphProps() override;
-    using ofxBaseFont::typesetString;
     
 private:
     static std::shared_ptr<FT_LibraryRec_> ft_library_;
     
+    static std::mutex ft_library_mutex_;
+    
     std::string file_path_;
+    int face_index_;
+    std::atomic<unsigned int> load_generation_;
     std::shared_ptr<FT_FaceRec_> ft_face_;
+    std::shared_future<int> load_future_;
+    
+    // Note: Instances of the same file share one face, and each of them has its own FT_Size (and its own glyph cache and atlas).
+    //       lockFace() must be held while the face is used, since it also activates the size of this instance.
+    std::shared_ptr<ofxSharedFTFace> shared_face_;
+    std::shared_ptr<FT_SizeRec_> ft_size_;
+    std::unique_lock<std::recursive_mutex> lockFace() const;
+    void releaseFace();
     bool is_mono_font_;
     float internal_scale_factor_;
     DrawingMode drawing_mode_;
 
     int getGlyphIndex(const std::u32string &code_point);
+    int getGlyphIndex(const ofxMixedFontUtil::ofxGlyphProps &glyph_props);
+    int findGlyphIndex(const std::u32string &code_point) const;
+    int findGlyphIndex(const ofxMixedFontUtil::ofxGlyphProps &glyph_props) const;
     int loadGlyph(const std::u32string &code_point, bool try_load_sub = false);
+    int loadGlyphById(const int &glyph_id, const std::u32string &code_point);
+    int getSequenceGlyphIndex(const std::u32string &sequence);
+    int rasterizeGlyph(const int &glyph_index);
+    int rasterizeGlyphOrNotDef(const int &glyph_index);
+    int rasterizeSubpixelVariant(const int &glyph_index, const int &phase);
+    int loadGlyphOutline(const int &glyph_index);
     int makeSpaceGlyphProps(const char32_t &code_point, const float &scale);
 
+    enum GlyphState { GLYPH_METRICS_LOADED = 0, GLYPH_BITMAP_LOADED = 1, GLYPH_OUTLINE_LOADED = 2, GLYPH_BITMAP_FAILED = 4 }; // Note: A failed glyph is drawn as .notdef
     std::vector<ofxMixedFontUtil::ofxGlyphData> loaded_glyphs_;
     std::vector<ofPath> loaded_glyph_outlines_;
+    std::vector<int> loaded_glyph_ids_;
+    std::vector<unsigned char> loaded_glyph_states_;
+    std::unordered_map<int, int> glyph_id_indices_;
+    std::unordered_map<std::u32string, int> sequence_indices_; // Note: code point sequence -> index of loaded_glyphs_ (0 if the font doesn't have it)
+    
+    int subpixel_phase_count_;
+    std::vector<ofxMixedFontUtil::ofxGlyphData> subpixel_variants_;
+    std::unordered_map<unsigned long long, int> subpixel_variant_indices_; // Note: (index of loaded_glyphs_, phase) -> index of subpixel_variants_
+    
+    struct KerningPair {
+        unsigned long long key;
+        int adjustment;
+    };
+    std::vector<KerningPair> kerning_pairs_;
+    std::size_t kerning_pair_count_;
+    bool kerning_is_enabled_;
+    bool has_gpos_table_;
+    int findKerningPair(const unsigned long long &key) const;
+    void addKerningPair(const unsigned long long &key, const int &adjustment);
+    int computeKerning(const int &left_glyph_id, const int &right_glyph_id);
+    
+    struct HarfBuzzState;
+    std::shared_ptr<HarfBuzzState> hb_state_;
+    bool shaping_is_enabled_;
+    ShapingOptions shaping_options_;
     
     static const int ATLAS_TEXTURE_SIZE;
     std::shared_ptr<ofPixels> atlas_pixels_;
-    std::shared_ptr<ofTexture> atlas_texture_;
+    std::shared_ptr<ofTexture> atlas_texture_; // Note: made once, and (re)allocated only in bind() on the GL thread
+    bool atlas_texture_needs_allocation_;
     int atlas_offset_x_;
     int atlas_offset_y_;
     int next_atlas_offset_y_;
@@ -87,8 +216,19 @@ private:
     int blend_src_, blend_dst_;
     std::unique_ptr<ofColor> color_;
     
+    static int render_state_depth_;
+    static bool render_state_blend_is_enabled_;
+    static int render_state_blend_src_, render_state_blend_dst_;
+    static int render_state_current_sfactor_;
+    
+    static bool is_batching_;
+    static std::vector<std::shared_ptr<ofxFT2Font>> batched_fonts_;
+    bool has_batched_quads_;
+    
     void bind();
-    void addCharQuad(const int &glyph_index, const ofPoint &coord);
+    ofPoint getGlyphOrigin(const ofxMixedFontUtil::ofxGlyphData &glyph, const int &glyph_index) const;
+    void addGlyphQuad(const int &glyph_index, const ofPoint &coord);
+    void addCharQuad(const ofxMixedFontUtil::ofxGlyphData &entry, const ofPoint &coord);
     void unbind();
     
 };
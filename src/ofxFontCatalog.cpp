@@ -0,0 +1,351 @@
+#include "ofxFontCatalog.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <unordered_map>
+
+#include <sys/stat.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_TRUETYPE_TABLES_H
+
+#include "ofFileUtils.h"
+#include "ofLog.h"
+#include "ofUtils.h"
+
+static const char INDEX_MAGIC[8] = { 'O', 'F', 'X', 'M', 'F', 'C', 'I', '\0' };
+static const std::uint32_t INDEX_VERSION = 1;
+
+static bool statFontFile(const std::string &file_path, std::uint64_t &file_size, std::int64_t &modified_time)
+{
+    struct stat file_stat;
+    if (stat(file_path.c_str(), &file_stat) != 0) {
+        return false;
+    }
+    file_size = file_stat.st_size;
+    modified_time = file_stat.st_mtime;
+    
+    return true;
+}
+
+static unsigned int getColorTables(FT_Face ft_face)
+{
+    static const struct { FT_ULong tag; unsigned int flag; } tables[] = {
+        { FT_MAKE_TAG('C', 'B', 'D', 'T'), ofxFontCatalog::COLOR_TABLE_CBDT },
+        { FT_MAKE_TAG('s', 'b', 'i', 'x'), ofxFontCatalog::COLOR_TABLE_SBIX },
+        { FT_MAKE_TAG('C', 'O', 'L', 'R'), ofxFontCatalog::COLOR_TABLE_COLR },
+        { FT_MAKE_TAG('S', 'V', 'G', ' '), ofxFontCatalog::COLOR_TABLE_SVG },
+    };
+    
+    unsigned int color_tables = 0;
+    for (auto &table : tables) {
+        FT_ULong length = 0;
+        FT_Load_Sfnt_Table(ft_face, table.tag, 0, nullptr, &length);
+        if (length > 0) {
+            color_tables |= table.flag;
+        }
+    }
+    
+    return color_tables;
+}
+
+static void getCoverage(FT_Face ft_face, std::vector<std::pair<char32_t, char32_t>> &coverage)
+{
+    if (FT_Select_Charmap(ft_face, FT_ENCODING_UNICODE) != 0) {
+        return;
+    }
+    
+    // Note: FT_Get_Next_Char() visits code points in ascending order
+    FT_UInt glyph_id = 0;
+    FT_ULong code_point = FT_Get_First_Char(ft_face, &glyph_id);
+    while (glyph_id != 0) {
+        if (!coverage.empty() && coverage.back().second + 1 == code_point) {
+            coverage.back().second = code_point;
+        }
+        else {
+            coverage.push_back(std::make_pair(static_cast<char32_t>(code_point), static_cast<char32_t>(code_point)));
+        }
+        code_point = FT_Get_Next_Char(ft_face, code_point, &glyph_id);
+    }
+}
+
+static int scanFontFile(FT_Library ft_library, const std::string &file_path, const std::uint64_t &file_size, const std::int64_t &modified_time, std::vector<ofxFontCatalog::Entry> &entries)
+{
+    FT_Long face_count = 1;
+    for (FT_Long face_index = 0; face_index < face_count; ++face_index) {
+        FT_Face ft_face;
+        if (FT_New_Face(ft_library, file_path.c_str(), face_index, &ft_face) != 0) {
+            return -1;
+        }
+        face_count = ft_face->num_faces;
+        
+        ofxFontCatalog::Entry entry;
+        entry.file_path = file_path;
+        entry.face_index = face_index;
+        entry.family_name = ft_face->family_name ? ft_face->family_name : "";
+        entry.style_name = ft_face->style_name ? ft_face->style_name : "";
+        const char *postscript_name = FT_Get_Postscript_Name(ft_face);
+        entry.postscript_name = postscript_name ? postscript_name : "";
+        entry.color_tables = getColorTables(ft_face);
+        entry.file_size = file_size;
+        entry.modified_time = modified_time;
+        getCoverage(ft_face, entry.coverage);
+        entries.push_back(entry);
+        
+        FT_Done_Face(ft_face);
+    }
+    
+    return 0;
+}
+
+ofxFontCatalog::ofxFontCatalog()
+{
+
+}
+
+int ofxFontCatalog::scan(const std::string &directory, const int &thread_count)
+{
+    ofDirectory font_directory(ofToDataPath(directory, true));
+    if (!font_directory.exists()) {
+        ofLogError("ofxFontCatalog") << "scan(): couldn't find directory \"" << directory << "\"";
+        return -1;
+    }
+    for (auto &extension : { "ttf", "otf", "ttc", "otc", "TTF", "OTF", "TTC", "OTC" }) {
+        font_directory.allowExt(extension);
+    }
+    font_directory.listDir();
+    font_directory.sort();
+    
+    std::unordered_map<std::string, std::vector<Entry>> previous_entries;
+    for (auto &entry : entries_) {
+        previous_entries[entry.file_path].push_back(entry);
+    }
+    
+    typedef struct {
+        std::string file_path;
+        std::uint64_t file_size;
+        std::int64_t modified_time;
+        std::vector<Entry> entries;
+        bool needs_scan;
+        int result;
+    } Job;
+    std::vector<Job> jobs;
+    for (std::size_t i = 0; i < font_directory.size(); ++i) {
+        Job job = { font_directory.getPath(i), 0, 0, std::vector<Entry>(), true, 0 };
+        if (!statFontFile(job.file_path, job.file_size, job.modified_time)) {
+            continue;
+        }
+        auto found = previous_entries.find(job.file_path);
+        if (found != previous_entries.end() && found->second[0].file_size == job.file_size && found->second[0].modified_time == job.modified_time) {
+            job.entries = found->second;
+            job.needs_scan = false;
+        }
+        jobs.push_back(job);
+    }
+    
+    // Note: FT_Library isn't thread safe, so each worker has its own
+    std::atomic<std::size_t> next_job(0);
+    auto worker = [&jobs, &next_job]() {
+        FT_Library ft_library;
+        if (FT_Init_FreeType(&ft_library) != 0) {
+            return;
+        }
+        for (std::size_t i = next_job++; i < jobs.size(); i = next_job++) {
+            if (jobs[i].needs_scan) {
+                jobs[i].result = scanFontFile(ft_library, jobs[i].file_path, jobs[i].file_size, jobs[i].modified_time, jobs[i].entries);
+            }
+        }
+        FT_Done_FreeType(ft_library);
+    };
+    
+    int worker_count = (thread_count > 0) ? thread_count : std::max(1u, std::thread::hardware_concurrency());
+    worker_count = std::max(1, std::min<int>(worker_count, jobs.size()));
+    std::vector<std::thread> workers;
+    for (int i = 1; i < worker_count; ++i) {
+        workers.push_back(std::thread(worker));
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+    
+    std::vector<Entry> entries;
+    for (auto &job : jobs) {
+        if (job.result != 0) {
+            ofLogWarning("ofxFontCatalog") << "scan(): couldn't read font \"" << job.file_path << "\"";
+        }
+        entries.insert(entries.end(), job.entries.begin(), job.entries.end());
+    }
+    entries_.swap(entries);
+    
+    return entries_.size();
+}
+
+template<typename T>
+static void writeValue(std::ofstream &stream, const T &value)
+{
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+static void writeString(std::ofstream &stream, const std::string &value)
+{
+    writeValue<std::uint32_t>(stream, value.length());
+    stream.write(value.data(), value.length());
+}
+
+template<typename T>
+static bool readValue(std::ifstream &stream, T &value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+static bool readString(std::ifstream &stream, std::string &value)
+{
+    std::uint32_t length = 0;
+    if (!readValue(stream, length) || length > (1 << 16)) {
+        return false;
+    }
+    value.resize(length);
+    
+    return length == 0 || static_cast<bool>(stream.read(&value[0], length));
+}
+
+int ofxFontCatalog::save(const std::string &index_file_name) const
+{
+    std::ofstream stream(ofToDataPath(index_file_name, true), std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        ofLogError("ofxFontCatalog") << "save(): couldn't open \"" << index_file_name << "\"";
+        return -1;
+    }
+    
+    stream.write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    writeValue(stream, INDEX_VERSION);
+    writeValue<std::uint32_t>(stream, entries_.size());
+    for (auto &entry : entries_) {
+        writeString(stream, entry.file_path);
+        writeValue<std::int32_t>(stream, entry.face_index);
+        writeString(stream, entry.family_name);
+        writeString(stream, entry.style_name);
+        writeString(stream, entry.postscript_name);
+        writeValue<std::uint32_t>(stream, entry.color_tables);
+        writeValue(stream, entry.file_size);
+        writeValue(stream, entry.modified_time);
+        writeValue<std::uint32_t>(stream, entry.coverage.size());
+        for (auto &range : entry.coverage) {
+            writeValue(stream, range.first);
+            writeValue(stream, range.second);
+        }
+    }
+    
+    if (!stream) {
+        ofLogError("ofxFontCatalog") << "save(): couldn't write \"" << index_file_name << "\"";
+        return -2;
+    }
+    
+    return 0;
+}
+
+int ofxFontCatalog::load(const std::string &index_file_name)
+{
+    std::ifstream stream(ofToDataPath(index_file_name, true), std::ios::binary);
+    if (!stream) {
+        return -1;
+    }
+    
+    char magic[sizeof(INDEX_MAGIC)];
+    std::uint32_t version = 0;
+    std::uint32_t entry_count = 0;
+    if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0
+        || !readValue(stream, version) || version != INDEX_VERSION || !readValue(stream, entry_count)) {
+        ofLogError("ofxFontCatalog") << "load(): \"" << index_file_name << "\" is broken or of another version";
+        return -2;
+    }
+    
+    std::vector<Entry> entries;
+    for (std::uint32_t i = 0; i < entry_count; ++i) {
+        Entry entry;
+        std::int32_t face_index = 0;
+        std::uint32_t color_tables = 0;
+        std::uint32_t range_count = 0;
+        bool is_ok = readString(stream, entry.file_path) && readValue(stream, face_index)
+        && readString(stream, entry.family_name) && readString(stream, entry.style_name) && readString(stream, entry.postscript_name)
+        && readValue(stream, color_tables) && readValue(stream, entry.file_size) && readValue(stream, entry.modified_time)
+        && readValue(stream, range_count);
+        for (std::uint32_t j = 0; is_ok && j < range_count; ++j) {
+            std::pair<char32_t, char32_t> range;
+            is_ok = readValue(stream, range.first) && readValue(stream, range.second);
+            entry.coverage.push_back(range);
+        }
+        if (!is_ok) {
+            ofLogError("ofxFontCatalog") << "load(): \"" << index_file_name << "\" is broken";
+            return -2;
+        }
+        entry.face_index = face_index;
+        entry.color_tables = color_tables;
+        entries.push_back(entry);
+    }
+    entries_.swap(entries);
+    
+    return 0;
+}
+
+const std::vector<ofxFontCatalog::Entry> &ofxFontCatalog::getEntries() const
+{
+    return entries_;
+}
+
+int ofxFontCatalog::findEntry(const std::string &family_name, const std::string &style_name) const
+{
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        if (entries_[i].family_name == family_name && (style_name.empty() || entries_[i].style_name == style_name)) {
+            return i;
+        }
+    }
+    
+    return -1;
+}
+
+std::vector<int> ofxFontCatalog::findFallbackChain(const std::u32string &utf32_string, const std::vector<int> &preferred_entries) const
+{
+    std::vector<int> candidates;
+    for (auto &index : preferred_entries) {
+        if (0 <= index && index < entries_.size()) {
+            candidates.push_back(index);
+        }
+    }
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        candidates.push_back(i);
+    }
+    
+    std::vector<int> chain;
+    for (auto &code_point : utf32_string) {
+        auto is_covered = [&](const int &index) { return hasCodePoint(entries_[index], code_point); };
+        if (std::any_of(chain.begin(), chain.end(), is_covered)) {
+            continue;
+        }
+        auto found = std::find_if(candidates.begin(), candidates.end(), is_covered);
+        if (found != candidates.end()) {
+            chain.push_back(*found);
+        }
+    }
+    
+    return chain;
+}
+
+bool ofxFontCatalog::hasCodePoint(const Entry &entry, const char32_t &code_point)
+{
+    auto found = std::upper_bound(entry.coverage.begin(), entry.coverage.end(), code_point, [](const char32_t &value, const std::pair<char32_t, char32_t> &range) {
+        return value < range.first;
+    });
+    
+    return found != entry.coverage.begin() && code_point <= (found - 1)->second;
+}
+
+bool ofxFontCatalog::isColorBitmapFont(const Entry &entry)
+{
+    return (entry.color_tables & (COLOR_TABLE_CBDT | COLOR_TABLE_SBIX)) != 0;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Note: ofxFontCatalog scans a directory of fonts on several threads, and keeps the names, the cmap coverage and the color tables of each face.
+//       Saved as an index file, it lets later runs choose fallback chains without opening font files that won't be used.
+class ofxFontCatalog
+{
+public:
+    enum ColorTable { COLOR_TABLE_CBDT = 1, COLOR_TABLE_SBIX = 2, COLOR_TABLE_COLR = 4, COLOR_TABLE_SVG = 8 };
+    
+    typedef struct {
+        std::string file_path;
+        int face_index;
+        std::string family_name;
+        std::string style_name;
+        std::string postscript_name;
+        unsigned int color_tables; // Note: ColorTable flags
+        std::uint64_t file_size; // Note: file size and modification time tell whether the entry is stale
+        std::int64_t modified_time;
+        std::vector<std::pair<char32_t, char32_t>> coverage; // Note: sorted [first, last] ranges of the Unicode cmap
+    } Entry;
+    
+    ofxFontCatalog();
+    virtual ~ofxFontCatalog() {};
+    
+    // Note: Returns the number of faces. Entries of files that haven't changed since the last scan() or load() are reused without opening them.
+    //       thread_count 0 uses std::thread::hardware_concurrency().
+    int scan(const std::string &directory, const int &thread_count = 0);
+    int save(const std::string &index_file_name) const;
+    int load(const std::string &index_file_name);
+    
+    const std::vector<Entry> &getEntries() const;
+    int findEntry(const std::string &family_name, const std::string &style_name = "") const;
+    // Note: Entries which cover the string, in the order they are first needed. Preferred entries are tried before the others.
+    std::vector<int> findFallbackChain(const std::u32string &utf32_string, const std::vector<int> &preferred_entries = std::vector<int>()) const;
+    
+    static bool hasCodePoint(const Entry &entry, const char32_t &code_point);
+    static bool isColorBitmapFont(const Entry &entry); // Note: the same test as ofxFT2Font, which renders these fonts as color bitmaps
+
+private:
+    std::vector<Entry> entries_;
+
+};
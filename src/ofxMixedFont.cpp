@@ -1,7 +1,11 @@
 #include "ofxMixedFont.hpp"
+#include "ofxMixedFontGraphemeBreak.hpp"
+
+#include <algorithm>
 
 #include "ofTexture.h"
 #include "ofPath.h"
+#include "ofPixels.h"
 
 typedef struct {
     std::weak_ptr<ofxMixedFontUtil::ofxBaseFont> font;
@@ -10,27 +14,97 @@ typedef struct {
 
 bool ofxMixedFont::add(const ofxBaseFontPtr &font)
 {
-    bool is_successful = false;
-    
-    if (font->isReady()) {
-        font_list.push_back(font);
-        if (font_list.size() == 1) {
-            is_ready_ = true;
-            texture_is_enabled_ = font->textureIsEnabled();
-            path_is_enabled_ = font->pathIsEnabled();
-            font_props_ = font->getFontProps();
-         }
-        else {
-            texture_is_enabled_ &= font->textureIsEnabled();
-            path_is_enabled_ &= font->pathIsEnabled();
+    if (!font) return false;
+    
+    if (clip_rectangle_) {
+        font->setClipRectangle(*clip_rectangle_);
+    }
+    added_fonts_.push_back(font);
+    is_ready_ = true;
+    updateFontList();
+    
+    return font->isReady();
+}
+
+void ofxMixedFont::setFallbackProvider(const ofxFallbackFontProvider &provider)
+{
+    fallback_provider_ = provider;
+    asked_fallback_code_points_.clear();
+}
+
+bool ofxMixedFont::addFallbackFont(const char32_t &code_point)
+{
+    if (!fallback_provider_) return false;
+    if (!asked_fallback_code_points_.insert(code_point).second) return false;
+    
+    ofxBaseFontPtr font = fallback_provider_(code_point);
+    if (!font || std::find(added_fonts_.begin(), added_fonts_.end(), font) != added_fonts_.end()) {
+        return false;
+    }
+    
+    return add(font);
+}
+
+void ofxMixedFont::prepareTypeset()
+{
+    updateFontList();
+}
+
+void ofxMixedFont::updateFontList()
+{
+    // Note: Fonts are compared one by one, since a font may also become not ready while it is reloaded (ex. ofxFT2Font::loadAsync())
+    std::size_t ready_font_count = 0;
+    bool list_is_changed = false;
+    for (auto &font : added_fonts_) {
+        if (font->isReady()) {
+            list_is_changed = list_is_changed || ready_font_count >= font_list.size() || font_list[ready_font_count] != font;
+            ++ready_font_count;
         }
-        is_successful = true;
     }
-    else {
-        
+    if (!list_is_changed && ready_font_count == font_list.size()) return;
+    
+    font_list.clear();
+    for (auto &font : added_fonts_) {
+        if (font->isReady()) {
+            if (font_list.empty()) {
+                texture_is_enabled_ = font->textureIsEnabled();
+                path_is_enabled_ = font->pathIsEnabled();
+                font_props_ = font->getFontProps();
+            }
+            else {
+                texture_is_enabled_ = texture_is_enabled_ && font->textureIsEnabled();
+                path_is_enabled_ = path_is_enabled_ && font->pathIsEnabled();
+            }
+            font_list.push_back(font);
+        }
+    }
+    clearTypesetCache();
+}
+
+std::size_t ofxMixedFont::getTypesetConfigHash() const
+{
+    std::size_t hash = ofxBaseFont::getTypesetConfigHash();
+    for (auto &font : font_list) {
+        hash = ofxMixedFontUtil::combineHash(hash, font->getTypesetConfigHash());
     }
     
-    return is_successful;
+    return hash;
+}
+
+void ofxMixedFont::setClipRectangle(const ofRectangle &clip_rectangle)
+{
+    ofxBaseFont::setClipRectangle(clip_rectangle);
+    for (auto &font : added_fonts_) {
+        font->setClipRectangle(clip_rectangle);
+    }
+}
+
+void ofxMixedFont::clearClipRectangle()
+{
+    ofxBaseFont::clearClipRectangle();
+    for (auto &font : added_fonts_) {
+        font->clearClipRectangle();
+    }
 }
 
 ofxMixedFontUtil::ofxGlyphData ofxMixedFont::makeGlyphData(const std::u32string &utf32_character, const int &index, int &length)
@@ -38,26 +112,67 @@ ofxMixedFontUtil::ofxGlyphData ofxMixedFont::makeGlyphData(const std::u32string
     length = -1; // Note: This font is not ready.
     if (!isReady()) return ofxMixedFontUtil::ofxGlyphData();
     
+    // Note: A font which has the whole grapheme cluster (ex. emoji ZWJ sequence) takes precedence over one which has only its first code point
+    const int cluster_length = ofxMixedFontUtil::getGraphemeClusterLength(utf32_character, index);
     length = 0;
-    ofxMixedFontUtil::ofxGlyphData glyph;
+    ofxMixedFontUtil::ofxGlyphData glyph = ofxMixedFontUtil::ofxGlyphData();
     bool glyph_is_found = false;
     for (auto &font : font_list) {
         int tmp_length = 0;
         ofxMixedFontUtil::ofxGlyphData tmp_glyph = font->makeGlyphData(utf32_character, index, tmp_length);
-        if (tmp_length > 0) {
+        if (tmp_length >= cluster_length) {
             glyph = tmp_glyph;
             length = tmp_length;
             glyph_is_found = true;
             break;
         }
+        else if (tmp_length > 0 && length == 0) {
+            glyph = tmp_glyph;
+            length = tmp_length;
+        }
     }
-    if (!glyph_is_found && font_list.size() > 0) {
+    if (!glyph_is_found && length == 0 && index < utf32_character.length() && addFallbackFont(utf32_character[index])) {
+        return makeGlyphData(utf32_character, index, length);
+    }
+    if (!glyph_is_found && length == 0 && font_list.size() > 0) {
         glyph = font_list[0]->makeGlyphData(utf32_character, index, length);
     }
     
     return glyph;
 }
 
+int ofxMixedFont::appendGlyphData(const std::u32string &utf32_string, const int &index, std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list)
+{
+    if (!isReady()) return ofxBaseFont::appendGlyphData(utf32_string, index, glyph_list);
+    
+    // Note: Same precedence as makeGlyphData(). The advance of the preceding glyph is restored on rejection, since kerning may change it.
+    const int cluster_length = ofxMixedFontUtil::getGraphemeClusterLength(utf32_string, index);
+    const std::size_t glyph_count = glyph_list.size();
+    const float previous_advance = (glyph_count > 0) ? glyph_list.back().props.advance : 0.f;
+    ofxBaseFontPtr partial_font;
+    for (auto &font : font_list) {
+        int length = font->appendGlyphData(utf32_string, index, glyph_list);
+        if (length >= cluster_length) {
+            return length;
+        }
+        else if (length > 0 && !partial_font) {
+            partial_font = font;
+        }
+        glyph_list.resize(glyph_count);
+        if (glyph_count > 0) {
+            glyph_list.back().props.advance = previous_advance;
+        }
+    }
+    
+    if (partial_font) {
+        return partial_font->appendGlyphData(utf32_string, index, glyph_list);
+    }
+    if (index < utf32_string.length() && addFallbackFont(utf32_string[index])) {
+        return appendGlyphData(utf32_string, index, glyph_list);
+    }
+    return (font_list.size() > 0) ? font_list[0]->appendGlyphData(utf32_string, index, glyph_list) : 0;
+}
+
 void ofxMixedFont::drawGlyphs(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list)
 {
     if (!isReady()) return;
@@ -87,18 +202,52 @@ void ofxMixedFont::drawGlyphsWithPath(const std::vector<ofxMixedFontUtil::ofxGly
     }
 }
 
+void ofxMixedFont::drawGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color)
+{
+    if (!isReady()) return;
+    
+    for (auto &font : font_list) {
+        font->drawGlyphsIntoPixels(glyph_list, pixels, offset, color);
+    }
+}
+
+void ofxMixedFont::loadGlyphBitmaps(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list)
+{
+    if (!isReady()) return;
+    
+    for (auto &font : font_list) {
+        font->loadGlyphBitmaps(glyph_list);
+    }
+}
+
+void ofxMixedFont::drawLoadedGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color, const ofRectangle &region) const
+{
+    if (!isReady()) return;
+    
+    for (auto &font : font_list) {
+        font->drawLoadedGlyphsIntoPixels(glyph_list, pixels, offset, color, region);
+    }
+}
+
 void ofxMixedFont::drawString(const std::u32string &utf32_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func)
 {
     if (!isReady()) return;
     
-    std::vector<ofxMixedFontUtil::ofxGlyphData> glyph_list = typesetString(utf32_string, coord, func);
-    drawGlyphs(glyph_list);
+    ScopedTypesetBuffer buffer(typeset_buffer_);
+    typesetString(utf32_string, coord, buffer.glyphs, func);
+    drawGlyphs(buffer.glyphs);
 }
 
 ofTexture ofxMixedFont::getStringAsTexture(const std::u32string &utf32_string, const ofxMixedFontUtil::ofxCompFunc &func)
 {
-    // if (!isReady()) return ofTexture();
-    return ofTexture();
+    ofTexture texture;
+    
+    ofPixels pixels = getStringAsPixels(utf32_string, func);
+    if (pixels.isAllocated()) {
+        texture.allocate(pixels);
+    }
+    
+    return texture;
 }
 
 std::vector<ofPath> ofxMixedFont::getStringAsPath(const std::u32string &utf32_string, const ofxMixedFontUtil::ofxCompFunc &func)
@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include <functional>
+#include <unordered_set>
 #include "ofxMixedFontUtil.hpp"
 
 class ofTexture;
@@ -9,6 +11,7 @@ class ofPath;
 
 typedef std::shared_ptr<ofxMixedFontUtil::ofxBaseFont> ofxBaseFontPtr;
 typedef std::vector<ofxMixedFontUtil::ofxGlyphData> ofxGlyphDataList;
+typedef std::function<ofxBaseFontPtr (const char32_t &code_point)> ofxFallbackFontProvider;
 // class ofxMixedFont;
 // typedef std::shared_ptr<ofxMixedFont> ofxMixedFontPtr;
 
@@ -24,12 +27,26 @@ public:
     ofxMixedFont &operator=(const ofxMixedFont &) = delete;
     ofxMixedFont &operator=(ofxMixedFont &&) = delete;
     
+    // Note: A font which is not ready yet (ex. ofxFT2Font::loadAsync()) is used from the first typeset after it becomes ready.
+    //       Fonts keep the order of add() regardless of when they become ready.
+    //       Returns whether the font is ready now. ofxMixedFont is ready after the first add(), and draws nothing until one of its fonts is ready.
     bool add(const ofxBaseFontPtr &font);
-        
+    
+    // Note: The provider is asked for a font when no font of the list has a code point, once per code point.
+    //       The font it returns is added to the end of the list. (ex. ofxMixedFontUtil::makeSystemFallbackProvider())
+    void setFallbackProvider(const ofxFallbackFontProvider &provider);
+    
+    void setClipRectangle(const ofRectangle &clip_rectangle) override;
+    void clearClipRectangle() override;
+    
     ofxMixedFontUtil::ofxGlyphData makeGlyphData(const std::u32string &utf32_character, const int &index, int &length) override;
+    int appendGlyphData(const std::u32string &utf32_string, const int &index, std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
     void drawGlyphs(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
     void drawGlyphsWithTexture(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
     void drawGlyphsWithPath(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
+    void drawGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color) override;
+    void loadGlyphBitmaps(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list) override;
+    void drawLoadedGlyphsIntoPixels(const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color, const ofRectangle &region) const override;
     
     void drawString(const std::u32string &utf32_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func = ofxMixedFontUtil::defaultCompFunc) override;
     ofTexture getStringAsTexture(const std::u32string &utf32_string, const ofxMixedFontUtil::ofxCompFunc &func = ofxMixedFontUtil::defaultCompFunc) override;
@@ -40,6 +57,7 @@ public:
     using ofxBaseFont::pathIsEnabled;
     using ofxBaseFont::getFontProps;
     using ofxBaseFont::getDPI;
+    using ofxBaseFont::hasClipRectangle;
     using ofxBaseFont::drawString;
     using ofxBaseFont::drawStringWithTexture;
     using ofxBaseFont::drawStringWithPath;
@@ -47,15 +65,32 @@ public:
     using ofxBaseFont::getGlyphBoundingBoxes;
     using ofxBaseFont::getStringAsTexture;
     using ofxBaseFont::getStringAsPath;
+    using ofxBaseFont::getStringAsPixels;
+    using ofxBaseFont::setTypesetCacheCapacity;
+    using ofxBaseFont::clearTypesetCache;
+    using ofxBaseFont::getTypesetCacheStats;
+    using ofxBaseFont::typesetString;
+    using ofxBaseFont::setBaseDirection;
+    using ofxBaseFont::getBaseDirection;
+    using ofxBaseFont::fitString;
+    using ofxBaseFont::fitStrings;
+    std::size_t getTypesetConfigHash() const override;
     
 protected:
+    void prepareTypeset() override;
     int setNotDefGlyphProps() override {};
     int setSpaceGlyphProps() override {};
     int setFullWidthSpaceGlyphProps() override {};
     int setLineFeedGlyphProps() override {};
-    using ofxBaseFont::typesetString;
     
 private:
     std::vector<ofxBaseFontPtr> font_list;
+    std::vector<ofxBaseFontPtr> added_fonts_;
+    
+    void updateFontList();
+    
+    ofxFallbackFontProvider fallback_provider_;
+    std::unordered_set<char32_t> asked_fallback_code_points_;
+    bool addFallbackFont(const char32_t &code_point);
     
 };
@@ -0,0 +1,201 @@
+#include "ofxMixedFontAtlasCache.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace ofxMixedFontUtil {
+
+static std::uint64_t AlignOffset(const std::uint64_t &offset)
+{
+    return (offset + 7) & ~static_cast<std::uint64_t>(7);
+}
+
+static void HashBytes(const unsigned char *data, const std::size_t &size, std::uint64_t &hash)
+{
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+}
+
+static std::uint32_t ReadUInt32(const unsigned char *data)
+{
+    return (static_cast<std::uint32_t>(data[0]) << 24) | (static_cast<std::uint32_t>(data[1]) << 16) | (static_cast<std::uint32_t>(data[2]) << 8) | data[3];
+}
+
+static bool HashTableDirectory(const unsigned char *data, const std::size_t &size, const std::uint32_t &offset, std::uint64_t &hash)
+{
+    if (static_cast<std::uint64_t>(offset) + 12 > size) {
+        return false;
+    }
+    const std::uint32_t table_count = (static_cast<std::uint32_t>(data[offset + 4]) << 8) | data[offset + 5];
+    const std::uint64_t directory_size = 12 + static_cast<std::uint64_t>(table_count) * 16;
+    if (offset + directory_size > size) {
+        return false;
+    }
+    HashBytes(data + offset, directory_size, hash);
+    
+    // Note: The checksum of head in the directory is computed without checkSumAdjustment, which covers the whole file
+    for (std::uint32_t i = 0; i < table_count; ++i) {
+        const unsigned char *record = data + offset + 12 + i * 16;
+        if (std::memcmp(record, "head", 4) == 0) {
+            const std::uint64_t head_offset = ReadUInt32(record + 8);
+            if (head_offset + 12 > size) {
+                return false;
+            }
+            HashBytes(data + head_offset + 8, 4, hash);
+        }
+    }
+    
+    return true;
+}
+
+std::uint64_t hashFontTables(const unsigned char *data, const std::size_t &size)
+{
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    bool is_sfnt = false;
+    if (data && size >= 12 && std::memcmp(data, "ttcf", 4) == 0) {
+        const std::uint32_t font_count = ReadUInt32(data + 8);
+        is_sfnt = 12 + static_cast<std::uint64_t>(font_count) * 4 <= size;
+        if (is_sfnt) {
+            HashBytes(data, 12 + static_cast<std::size_t>(font_count) * 4, hash);
+        }
+        for (std::uint32_t i = 0; is_sfnt && i < font_count; ++i) {
+            is_sfnt = HashTableDirectory(data, size, ReadUInt32(data + 12 + i * 4), hash);
+        }
+    }
+    else if (data) {
+        is_sfnt = HashTableDirectory(data, size, 0, hash);
+    }
+    
+    // Note: Other formats (ex. Type 1, BDF) have no table checksums, and are hashed entirely
+    if (!is_sfnt) {
+        hash = 0xcbf29ce484222325ULL;
+        HashBytes(data, size, hash);
+    }
+    
+    return hash;
+}
+
+static bool WritePadded(std::FILE *file, const void *data, const std::size_t &size, const std::uint64_t &end_offset, std::uint64_t &offset)
+{
+    static const unsigned char padding[8] = {};
+    if (size > 0 && std::fwrite(data, 1, size, file) != size) {
+        return false;
+    }
+    offset += size;
+    if (end_offset > offset && std::fwrite(padding, 1, end_offset - offset, file) != end_offset - offset) {
+        return false;
+    }
+    offset = end_offset;
+    
+    return true;
+}
+
+int writeAtlasCache(const std::string &file_path, const ofxAtlasCacheHeader &header, const std::vector<ofxAtlasCacheGlyph> &glyphs, const std::vector<ofxAtlasCacheSequence> &sequences, const std::u32string &code_points, const unsigned char *pixels)
+{
+    ofxAtlasCacheHeader file_header = header;
+    std::memcpy(file_header.magic, ATLAS_CACHE_MAGIC, sizeof(ATLAS_CACHE_MAGIC));
+    file_header.version = ATLAS_CACHE_VERSION;
+    file_header.byte_order_mark = ATLAS_CACHE_BYTE_ORDER_MARK;
+    file_header.glyph_count = glyphs.size();
+    file_header.sequence_count = sequences.size();
+    file_header.code_point_count = code_points.length();
+    file_header.reserved = 0;
+    
+    const std::uint64_t pixels_size = static_cast<std::uint64_t>(header.atlas_width) * header.atlas_height * header.atlas_channels;
+    file_header.glyphs_offset = AlignOffset(sizeof(ofxAtlasCacheHeader));
+    file_header.sequences_offset = AlignOffset(file_header.glyphs_offset + glyphs.size() * sizeof(ofxAtlasCacheGlyph));
+    file_header.code_points_offset = AlignOffset(file_header.sequences_offset + sequences.size() * sizeof(ofxAtlasCacheSequence));
+    file_header.pixels_offset = AlignOffset(file_header.code_points_offset + code_points.length() * sizeof(char32_t));
+    file_header.file_size = file_header.pixels_offset + pixels_size;
+    
+    const std::string temporary_path = file_path + ".tmp";
+    std::FILE *file = std::fopen(temporary_path.c_str(), "wb");
+    if (!file) {
+        return -1;
+    }
+    
+    std::uint64_t offset = 0;
+    bool is_ok = WritePadded(file, &file_header, sizeof(file_header), file_header.glyphs_offset, offset)
+    && WritePadded(file, glyphs.data(), glyphs.size() * sizeof(ofxAtlasCacheGlyph), file_header.sequences_offset, offset)
+    && WritePadded(file, sequences.data(), sequences.size() * sizeof(ofxAtlasCacheSequence), file_header.code_points_offset, offset)
+    && WritePadded(file, code_points.data(), code_points.length() * sizeof(char32_t), file_header.pixels_offset, offset)
+    && WritePadded(file, pixels, pixels_size, file_header.file_size, offset);
+    is_ok = (std::fclose(file) == 0) && is_ok;
+    if (!is_ok) {
+        std::remove(temporary_path.c_str());
+        return -2;
+    }
+    
+    // Note: Readers which have mapped the previous file keep reading it
+    std::remove(file_path.c_str());
+    if (std::rename(temporary_path.c_str(), file_path.c_str()) != 0) {
+        std::remove(temporary_path.c_str());
+        return -3;
+    }
+    
+    return 0;
+}
+
+int readAtlasCache(const unsigned char *data, const std::size_t &size, ofxAtlasCacheView &view)
+{
+    if (!data || size < sizeof(ofxAtlasCacheHeader)) {
+        return -1;
+    }
+    
+    const ofxAtlasCacheHeader *header = reinterpret_cast<const ofxAtlasCacheHeader *>(data);
+    if (std::memcmp(header->magic, ATLAS_CACHE_MAGIC, sizeof(ATLAS_CACHE_MAGIC)) != 0 || header->byte_order_mark != ATLAS_CACHE_BYTE_ORDER_MARK) {
+        return -1;
+    }
+    if (header->version != ATLAS_CACHE_VERSION) {
+        return -2;
+    }
+    if (!(header->internal_scale_factor > 0) || std::isinf(header->internal_scale_factor)) {
+        return -3;
+    }
+    
+    const std::uint64_t pixels_size = static_cast<std::uint64_t>(header->atlas_width) * header->atlas_height * header->atlas_channels;
+    if (header->atlas_width < 0 || header->atlas_height < 0 || header->atlas_channels < 0 || header->file_size != size
+        || header->glyphs_offset < sizeof(ofxAtlasCacheHeader) || header->pixels_offset > size
+        || (header->glyphs_offset | header->sequences_offset | header->code_points_offset) % 8 != 0
+        || header->glyphs_offset + static_cast<std::uint64_t>(header->glyph_count) * sizeof(ofxAtlasCacheGlyph) > header->sequences_offset
+        || header->sequences_offset + static_cast<std::uint64_t>(header->sequence_count) * sizeof(ofxAtlasCacheSequence) > header->code_points_offset
+        || header->code_points_offset + static_cast<std::uint64_t>(header->code_point_count) * sizeof(char32_t) > header->pixels_offset
+        || header->pixels_offset + pixels_size > size) {
+        return -3;
+    }
+    
+    view.header = header;
+    view.glyphs = reinterpret_cast<const ofxAtlasCacheGlyph *>(data + header->glyphs_offset);
+    view.sequences = reinterpret_cast<const ofxAtlasCacheSequence *>(data + header->sequences_offset);
+    view.code_points = reinterpret_cast<const char32_t *>(data + header->code_points_offset);
+    view.pixels = data + header->pixels_offset;
+    for (std::uint32_t i = 0; i < header->glyph_count; ++i) {
+        const ofxAtlasCacheGlyph &glyph = view.glyphs[i];
+        if (static_cast<std::uint64_t>(glyph.code_point_begin) + glyph.code_point_length > header->code_point_count) {
+            return -3;
+        }
+        
+        // Note: width and height are scaled by internal_scale_factor, and the bitmap is stored unscaled
+        if (glyph.state & ATLAS_CACHE_GLYPH_BITMAP) {
+            const double bitmap_width = glyph.width / header->internal_scale_factor;
+            const double bitmap_height = glyph.height / header->internal_scale_factor;
+            if (!(glyph.atlas_x >= 0 && glyph.atlas_y >= 0) || glyph.width < 0 || glyph.height < 0
+                || std::floor(glyph.atlas_x + bitmap_width + 0.5) > header->atlas_width || std::floor(glyph.atlas_y + bitmap_height + 0.5) > header->atlas_height) {
+                return -3;
+            }
+        }
+    }
+    for (std::uint32_t i = 0; i < header->sequence_count; ++i) {
+        if (static_cast<std::uint64_t>(view.sequences[i].code_point_begin) + view.sequences[i].code_point_length > header->code_point_count
+            || view.sequences[i].glyph_index >= header->glyph_count) {
+            return -3;
+        }
+    }
+    
+    return 0;
+}
+
+}
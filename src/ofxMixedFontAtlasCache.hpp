@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Note: This file doesn't depend on openFrameworks, so that tools can write atlas cache files offline.
+
+namespace ofxMixedFontUtil {
+
+// Note: File layout (native byte order, 8-byte aligned sections)
+//       ofxAtlasCacheHeader | ofxAtlasCacheGlyph[glyph_count] | ofxAtlasCacheSequence[sequence_count] | char32_t[code_point_count]
+//       | atlas rows (atlas_width * atlas_height * atlas_channels bytes)
+static const char ATLAS_CACHE_MAGIC[8] = { 'O', 'F', 'X', 'M', 'F', 'A', 'C', '\0' };
+static const std::uint32_t ATLAS_CACHE_VERSION = 2;
+static const std::uint32_t ATLAS_CACHE_BYTE_ORDER_MARK = 0x01020304;
+
+// Note: glyph state flags
+static const std::uint32_t ATLAS_CACHE_GLYPH_BITMAP = 1;
+
+typedef struct {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order_mark;
+    
+    // Note: key; a cache is used only if all of these match
+    std::uint64_t font_hash; // Note: hashFontTables() of the font file
+    std::uint64_t font_file_size;
+    std::int64_t font_modification_time; // Note: 0 matches any time (ex. caches baked offline, which are copied with the app)
+    std::int32_t face_index;
+    float font_size_pt;
+    float dpi;
+    std::int32_t load_flags;
+    std::int32_t render_mode;
+    std::int32_t freetype_version; // Note: major * 10000 + minor * 100 + patch
+    
+    float internal_scale_factor;
+    std::int32_t atlas_width;
+    std::int32_t atlas_height; // Note: rows stored in the file, not the height of the atlas
+    std::int32_t atlas_channels;
+    std::int32_t atlas_offset_x;
+    std::int32_t atlas_offset_y;
+    std::int32_t next_atlas_offset_y;
+    std::uint32_t glyph_count;
+    std::uint32_t sequence_count;
+    std::uint32_t code_point_count;
+    std::uint32_t reserved;
+    std::uint64_t glyphs_offset;
+    std::uint64_t sequences_offset;
+    std::uint64_t code_points_offset;
+    std::uint64_t pixels_offset;
+    std::uint64_t file_size;
+} ofxAtlasCacheHeader;
+
+typedef struct {
+    std::int32_t glyph_id;
+    std::int32_t width;
+    std::int32_t height;
+    std::int32_t bearing_x;
+    std::int32_t bearing_y;
+    std::int32_t advance;
+    std::int32_t vertical_bearing_x;
+    std::int32_t vertical_bearing_y;
+    std::int32_t vertical_advance;
+    float atlas_x;
+    float atlas_y;
+    std::uint32_t state;
+    std::uint32_t code_point_begin;
+    std::uint32_t code_point_length;
+} ofxAtlasCacheGlyph;
+
+// Note: a code point sequence that has been looked up, and the glyph it maps to (0 if the font doesn't have it)
+typedef struct {
+    std::uint32_t code_point_begin;
+    std::uint32_t code_point_length;
+    std::uint32_t glyph_index;
+} ofxAtlasCacheSequence;
+
+typedef struct {
+    const ofxAtlasCacheHeader *header;
+    const ofxAtlasCacheGlyph *glyphs;
+    const ofxAtlasCacheSequence *sequences;
+    const char32_t *code_points;
+    const unsigned char *pixels;
+} ofxAtlasCacheView;
+
+// Note: 64-bit FNV-1a of the sfnt table directories (whose checksums cover every table) and head.checkSumAdjustment,
+//       so that only the first pages of a mapped font file are read. Fonts of other formats are hashed entirely.
+std::uint64_t hashFontTables(const unsigned char *data, const std::size_t &size);
+
+// Note: Fills magic, version, offsets and counts of the header. The file is written to a temporary file and renamed.
+int writeAtlasCache(const std::string &file_path, const ofxAtlasCacheHeader &header, const std::vector<ofxAtlasCacheGlyph> &glyphs, const std::vector<ofxAtlasCacheSequence> &sequences, const std::u32string &code_points, const unsigned char *pixels);
+
+// Note: Checks magic, version and bounds (including indices into the tables and glyph rectangles in the atlas) of a cache file in memory, and points the view into it
+int readAtlasCache(const unsigned char *data, const std::size_t &size, ofxAtlasCacheView &view);
+
+}
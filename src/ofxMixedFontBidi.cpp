@@ -0,0 +1,407 @@
+#include "ofxMixedFontBidi.hpp"
+#include "ofxMixedFontBidiTable.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace ofxMixedFontUtil {
+
+static const int MAX_DEPTH = 125;
+
+typedef struct {
+    unsigned char level;
+    ofxBidiClass override_class; // Note: BIDI_ON means no override
+    bool is_isolate;
+} DirectionalStatus;
+
+static bool IsStrong(const ofxBidiClass &bidi_class)
+{
+    return (bidi_class == BIDI_L || bidi_class == BIDI_R || bidi_class == BIDI_AL);
+}
+
+static bool IsIsolateInitiator(const ofxBidiClass &bidi_class)
+{
+    return (bidi_class == BIDI_LRI || bidi_class == BIDI_RLI || bidi_class == BIDI_FSI);
+}
+
+static bool IsNeutralOrIsolate(const ofxBidiClass &bidi_class)
+{
+    return (bidi_class == BIDI_B || bidi_class == BIDI_S || bidi_class == BIDI_WS || bidi_class == BIDI_ON
+            || IsIsolateInitiator(bidi_class) || bidi_class == BIDI_PDI);
+}
+
+static bool IsRemovedByX9(const ofxBidiClass &bidi_class)
+{
+    return (bidi_class == BIDI_BN || bidi_class == BIDI_LRE || bidi_class == BIDI_LRO || bidi_class == BIDI_RLE
+            || bidi_class == BIDI_RLO || bidi_class == BIDI_PDF);
+}
+
+// Note: P2, P3. Returns -1 when there is no strong character.
+static int FindFirstStrongLevel(const std::vector<ofxBidiClass> &classes, const int &begin, const int &end, const bool &stops_at_pdi)
+{
+    int isolate_depth = 0;
+    for (int i = begin; i < end; ++i) {
+        const ofxBidiClass bidi_class = classes[i];
+        if (IsIsolateInitiator(bidi_class)) {
+            ++isolate_depth;
+        }
+        else if (bidi_class == BIDI_PDI) {
+            if (isolate_depth > 0) {
+                --isolate_depth;
+            }
+            else if (stops_at_pdi) {
+                break;
+            }
+        }
+        else if (isolate_depth == 0 && bidi_class == BIDI_L) {
+            return 0;
+        }
+        else if (isolate_depth == 0 && (bidi_class == BIDI_R || bidi_class == BIDI_AL)) {
+            return 1;
+        }
+    }
+    
+    return -1;
+}
+
+static void ResolveLevelRun(std::vector<ofxBidiClass> &classes, std::vector<unsigned char> &levels, const std::vector<int> &run, const ofxBidiClass &sos, const ofxBidiClass &eos)
+{
+    const int count = run.size();
+    const unsigned char level = levels[run[0]];
+    
+    // Note: W1 - W3
+    ofxBidiClass previous_class = sos;
+    ofxBidiClass last_strong = sos;
+    for (int i = 0; i < count; ++i) {
+        ofxBidiClass &bidi_class = classes[run[i]];
+        if (bidi_class == BIDI_NSM) {
+            bidi_class = (IsIsolateInitiator(previous_class) || previous_class == BIDI_PDI) ? BIDI_ON : previous_class;
+        }
+        if (bidi_class == BIDI_EN && last_strong == BIDI_AL) {
+            bidi_class = BIDI_AN;
+        }
+        if (IsStrong(bidi_class)) {
+            last_strong = bidi_class;
+        }
+        if (bidi_class == BIDI_AL) {
+            bidi_class = BIDI_R;
+        }
+        previous_class = bidi_class;
+    }
+    
+    // Note: W4
+    for (int i = 1; i + 1 < count; ++i) {
+        ofxBidiClass &bidi_class = classes[run[i]];
+        const ofxBidiClass before = classes[run[i - 1]];
+        const ofxBidiClass after = classes[run[i + 1]];
+        if (bidi_class == BIDI_ES && before == BIDI_EN && after == BIDI_EN) {
+            bidi_class = BIDI_EN;
+        }
+        else if (bidi_class == BIDI_CS && before == after && (before == BIDI_EN || before == BIDI_AN)) {
+            bidi_class = before;
+        }
+    }
+    
+    // Note: W5, W6
+    for (int i = 0; i < count;) {
+        if (classes[run[i]] != BIDI_ET) {
+            ++i;
+            continue;
+        }
+        int end = i;
+        while (end < count && classes[run[end]] == BIDI_ET) ++end;
+        const bool touches_en = (i > 0 && classes[run[i - 1]] == BIDI_EN) || (end < count && classes[run[end]] == BIDI_EN);
+        for (int j = i; j < end; ++j) {
+            classes[run[j]] = touches_en ? BIDI_EN : BIDI_ON;
+        }
+        i = end;
+    }
+    for (int i = 0; i < count; ++i) {
+        ofxBidiClass &bidi_class = classes[run[i]];
+        if (bidi_class == BIDI_ES || bidi_class == BIDI_CS) {
+            bidi_class = BIDI_ON;
+        }
+    }
+    
+    // Note: W7
+    last_strong = sos;
+    for (int i = 0; i < count; ++i) {
+        ofxBidiClass &bidi_class = classes[run[i]];
+        if (bidi_class == BIDI_L || bidi_class == BIDI_R) {
+            last_strong = bidi_class;
+        }
+        else if (bidi_class == BIDI_EN && last_strong == BIDI_L) {
+            bidi_class = BIDI_L;
+        }
+    }
+    
+    // Note: N1, N2 (EN and AN are treated as R)
+    const ofxBidiClass embedding_class = (level & 1) ? BIDI_R : BIDI_L;
+    for (int i = 0; i < count;) {
+        if (!IsNeutralOrIsolate(classes[run[i]])) {
+            ++i;
+            continue;
+        }
+        int end = i;
+        while (end < count && IsNeutralOrIsolate(classes[run[end]])) ++end;
+        
+        ofxBidiClass before = (i > 0) ? classes[run[i - 1]] : sos;
+        ofxBidiClass after = (end < count) ? classes[run[end]] : eos;
+        if (before == BIDI_EN || before == BIDI_AN) before = BIDI_R;
+        if (after == BIDI_EN || after == BIDI_AN) after = BIDI_R;
+        const ofxBidiClass resolved_class = (before == after) ? before : embedding_class;
+        for (int j = i; j < end; ++j) {
+            classes[run[j]] = resolved_class;
+        }
+        i = end;
+    }
+    
+    // Note: I1, I2
+    for (int i = 0; i < count; ++i) {
+        const ofxBidiClass bidi_class = classes[run[i]];
+        unsigned char &resolved_level = levels[run[i]];
+        if ((level & 1) == 0) {
+            if (bidi_class == BIDI_R) resolved_level = level + 1;
+            else if (bidi_class == BIDI_AN || bidi_class == BIDI_EN) resolved_level = level + 2;
+        }
+        else if (bidi_class == BIDI_L || bidi_class == BIDI_EN || bidi_class == BIDI_AN) {
+            resolved_level = level + 1;
+        }
+    }
+}
+
+static void ResolveParagraph(const std::vector<ofxBidiClass> &original_classes, std::vector<ofxBidiClass> &classes, const int &begin, const int &end, const ofxBidiDirection &direction, std::vector<unsigned char> &levels)
+{
+    unsigned char paragraph_level = (direction == BIDI_DIRECTION_RTL) ? 1 : 0;
+    if (direction == BIDI_DIRECTION_AUTO) {
+        paragraph_level = std::max(0, FindFirstStrongLevel(classes, begin, end, false));
+    }
+    
+    // Note: X1 - X8
+    std::vector<DirectionalStatus> stack;
+    stack.reserve(MAX_DEPTH + 2);
+    stack.push_back({ paragraph_level, BIDI_ON, false });
+    int overflow_isolate_count = 0;
+    int overflow_embedding_count = 0;
+    int valid_isolate_count = 0;
+    
+    for (int i = begin; i < end; ++i) {
+        ofxBidiClass bidi_class = classes[i];
+        switch (bidi_class) {
+            case BIDI_RLE:
+            case BIDI_LRE:
+            case BIDI_RLO:
+            case BIDI_LRO: {
+                const bool is_rtl = (bidi_class == BIDI_RLE || bidi_class == BIDI_RLO);
+                const unsigned char new_level = is_rtl ? ((stack.back().level + 1) | 1) : ((stack.back().level + 2) & ~1);
+                if (new_level <= MAX_DEPTH && overflow_isolate_count == 0 && overflow_embedding_count == 0) {
+                    const ofxBidiClass override_class = (bidi_class == BIDI_RLO) ? BIDI_R : ((bidi_class == BIDI_LRO) ? BIDI_L : BIDI_ON);
+                    stack.push_back({ new_level, override_class, false });
+                }
+                else if (overflow_isolate_count == 0) {
+                    ++overflow_embedding_count;
+                }
+                levels[i] = stack.back().level;
+                break;
+            }
+            case BIDI_RLI:
+            case BIDI_LRI:
+            case BIDI_FSI: {
+                levels[i] = stack.back().level;
+                if (stack.back().override_class != BIDI_ON) {
+                    classes[i] = stack.back().override_class;
+                }
+                bool is_rtl = (bidi_class == BIDI_RLI);
+                if (bidi_class == BIDI_FSI) {
+                    is_rtl = (FindFirstStrongLevel(original_classes, i + 1, end, true) == 1);
+                }
+                const unsigned char new_level = is_rtl ? ((stack.back().level + 1) | 1) : ((stack.back().level + 2) & ~1);
+                if (new_level <= MAX_DEPTH && overflow_isolate_count == 0 && overflow_embedding_count == 0) {
+                    ++valid_isolate_count;
+                    stack.push_back({ new_level, BIDI_ON, true });
+                }
+                else {
+                    ++overflow_isolate_count;
+                }
+                break;
+            }
+            case BIDI_PDI:
+                if (overflow_isolate_count > 0) {
+                    --overflow_isolate_count;
+                }
+                else if (valid_isolate_count > 0) {
+                    overflow_embedding_count = 0;
+                    while (!stack.back().is_isolate) stack.pop_back();
+                    stack.pop_back();
+                    --valid_isolate_count;
+                }
+                levels[i] = stack.back().level;
+                if (stack.back().override_class != BIDI_ON) {
+                    classes[i] = stack.back().override_class;
+                }
+                break;
+            case BIDI_PDF:
+                if (overflow_isolate_count > 0) {
+                }
+                else if (overflow_embedding_count > 0) {
+                    --overflow_embedding_count;
+                }
+                else if (!stack.back().is_isolate && stack.size() >= 2) {
+                    stack.pop_back();
+                }
+                levels[i] = stack.back().level;
+                break;
+            case BIDI_B:
+                levels[i] = paragraph_level;
+                break;
+            default:
+                levels[i] = stack.back().level;
+                if (stack.back().override_class != BIDI_ON && bidi_class != BIDI_BN) {
+                    classes[i] = stack.back().override_class;
+                }
+                break;
+        }
+    }
+    
+    // Note: X9, X10 (level runs are resolved as isolating run sequences of their own)
+    std::vector<int> run;
+    int previous_level = paragraph_level;
+    for (int i = begin; i < end;) {
+        if (IsRemovedByX9(original_classes[i])) {
+            ++i;
+            continue;
+        }
+        
+        run.clear();
+        const unsigned char level = levels[i];
+        int j = i;
+        for (; j < end; ++j) {
+            if (IsRemovedByX9(original_classes[j])) continue;
+            if (levels[j] != level) break;
+            run.push_back(j);
+        }
+        
+        int next_level = paragraph_level;
+        for (int k = j; k < end; ++k) {
+            if (!IsRemovedByX9(original_classes[k])) {
+                next_level = levels[k];
+                break;
+            }
+        }
+        if (IsIsolateInitiator(original_classes[run.back()])) {
+            next_level = paragraph_level;
+        }
+        
+        const ofxBidiClass sos = (std::max<int>(previous_level, level) & 1) ? BIDI_R : BIDI_L;
+        const ofxBidiClass eos = (std::max<int>(next_level, level) & 1) ? BIDI_R : BIDI_L;
+        ResolveLevelRun(classes, levels, run, sos, eos);
+        
+        previous_level = level;
+        i = j;
+    }
+    
+    // Note: L1 (line ends are handled when lines are reordered) and the levels of characters removed by X9
+    bool is_trailing = true;
+    for (int i = end - 1; i >= begin; --i) {
+        const ofxBidiClass bidi_class = original_classes[i];
+        if (bidi_class == BIDI_B || bidi_class == BIDI_S) {
+            levels[i] = paragraph_level;
+            is_trailing = true;
+        }
+        else if (is_trailing && (bidi_class == BIDI_WS || IsIsolateInitiator(bidi_class) || bidi_class == BIDI_PDI || IsRemovedByX9(bidi_class))) {
+            levels[i] = paragraph_level;
+        }
+        else {
+            is_trailing = false;
+        }
+    }
+    for (int i = begin; i < end; ++i) {
+        if (IsRemovedByX9(original_classes[i]) && !(i + 1 < end && original_classes[i + 1] == BIDI_B)) {
+            levels[i] = (i > begin) ? levels[i - 1] : paragraph_level;
+        }
+    }
+}
+
+ofxBidiClass getBidiClass(const char32_t &code_point)
+{
+    if (code_point > BIDI_MAX_CODE_POINT) {
+        return BIDI_L;
+    }
+    
+    const int block = BIDI_STAGE1[code_point >> BIDI_SHIFT];
+    return static_cast<ofxBidiClass>(BIDI_STAGE2[(block << BIDI_SHIFT) | (code_point & BIDI_MASK)]);
+}
+
+char32_t getBidiMirroringGlyph(const char32_t &code_point)
+{
+    auto found = std::lower_bound(std::begin(BIDI_MIRRORING_GLYPHS), std::end(BIDI_MIRRORING_GLYPHS), code_point, [](const char32_t (&pair)[2], const char32_t &value) {
+        return pair[0] < value;
+    });
+    
+    return (found != std::end(BIDI_MIRRORING_GLYPHS) && (*found)[0] == code_point) ? (*found)[1] : code_point;
+}
+
+bool needsBidiResolution(const std::u32string &utf32_string, const ofxBidiDirection &direction)
+{
+    if (direction == BIDI_DIRECTION_RTL) return true;
+    
+    for (auto &code_point : utf32_string) {
+        // Note: Characters below U+0590 are L, neutral, numbers or LTR controls
+        if (code_point < 0x0590) continue;
+        
+        const ofxBidiClass bidi_class = getBidiClass(code_point);
+        if (bidi_class == BIDI_R || bidi_class == BIDI_AL || bidi_class == BIDI_AN || bidi_class >= BIDI_LRE) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+void resolveBidiLevels(const std::u32string &utf32_string, const ofxBidiDirection &direction, std::vector<unsigned char> &levels)
+{
+    const int length = utf32_string.length();
+    levels.assign(length, 0);
+    
+    std::vector<ofxBidiClass> original_classes(length);
+    for (int i = 0; i < length; ++i) {
+        original_classes[i] = getBidiClass(utf32_string[i]);
+    }
+    std::vector<ofxBidiClass> classes = original_classes;
+    
+    for (int begin = 0; begin < length;) {
+        int end = begin;
+        while (end < length && original_classes[end] != BIDI_B) ++end;
+        if (end < length) ++end;
+        
+        ResolveParagraph(original_classes, classes, begin, end, direction, levels);
+        begin = end;
+    }
+}
+
+void getVisualOrder(const unsigned char *levels, const int &count, std::vector<int> &order)
+{
+    order.resize(count);
+    unsigned char highest_level = 0;
+    unsigned char lowest_odd_level = MAX_DEPTH + 2;
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+        highest_level = std::max(highest_level, levels[i]);
+        if (levels[i] & 1) lowest_odd_level = std::min(lowest_odd_level, levels[i]);
+    }
+    
+    for (int level = highest_level; level >= lowest_odd_level; --level) {
+        for (int i = 0; i < count;) {
+            if (levels[order[i]] < level) {
+                ++i;
+                continue;
+            }
+            int end = i;
+            while (end < count && levels[order[end]] >= level) ++end;
+            std::reverse(order.begin() + i, order.begin() + end);
+            i = end;
+        }
+    }
+}
+
+}
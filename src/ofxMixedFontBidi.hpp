@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ofxMixedFontUtil {
+
+// Note: UAX #9 bidirectional character types. Keep the order in sync with scripts/generate_unicode_tables.py
+typedef enum : unsigned char {
+    BIDI_L, BIDI_R, BIDI_AL, BIDI_EN, BIDI_ES, BIDI_ET, BIDI_AN, BIDI_CS, BIDI_NSM, BIDI_BN, BIDI_B, BIDI_S, BIDI_WS, BIDI_ON,
+    BIDI_LRE, BIDI_LRO, BIDI_RLE, BIDI_RLO, BIDI_PDF, BIDI_LRI, BIDI_RLI, BIDI_FSI, BIDI_PDI,
+} ofxBidiClass;
+
+typedef enum {
+    BIDI_DIRECTION_AUTO,
+    BIDI_DIRECTION_LTR,
+    BIDI_DIRECTION_RTL,
+} ofxBidiDirection;
+
+ofxBidiClass getBidiClass(const char32_t &code_point);
+
+// Note: Bidi_Mirroring_Glyph for L4. A character without a mirrored glyph is returned as it is.
+char32_t getBidiMirroringGlyph(const char32_t &code_point);
+
+// Note: Returns false when every character of the string gets level 0, so that resolveBidiLevels() can be skipped
+bool needsBidiResolution(const std::u32string &utf32_string, const ofxBidiDirection &direction);
+
+// Note: Resolves embedding levels of each character (paragraphs are split at paragraph separators).
+//       Bracket pairs (N0) are not resolved, so a bracket gets the direction of its context by N1 and N2.
+void resolveBidiLevels(const std::u32string &utf32_string, const ofxBidiDirection &direction, std::vector<unsigned char> &levels);
+
+// Note: Reorders a line (L2). order[i] is the logical index of the i-th character from the left.
+void getVisualOrder(const unsigned char *levels, const int &count, std::vector<int> &order);
+
+}
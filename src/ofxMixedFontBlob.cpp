@@ -0,0 +1,166 @@
+#include "ofxMixedFontBlob.hpp"
+#include "ofxMixedFontAtlasCache.hpp"
+
+#include <unordered_map>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ofLog.h"
+
+namespace ofxMixedFontUtil {
+
+static std::mutex blob_registry_mutex;
+static std::unordered_map<std::string, std::weak_ptr<const ofxFontBlob>> blob_registry;
+
+std::shared_ptr<const ofxFontBlob> ofxFontBlob::open(const std::string &file_path)
+{
+    std::lock_guard<std::mutex> lock(blob_registry_mutex);
+    
+    auto found = blob_registry.find(file_path);
+    if (found != blob_registry.end()) {
+        std::shared_ptr<const ofxFontBlob> blob = found->second.lock();
+        if (blob) {
+            return blob;
+        }
+        blob_registry.erase(found);
+    }
+    
+    std::shared_ptr<ofxFontBlob> blob(new ofxFontBlob());
+    if (blob->map(file_path) != 0) {
+        return std::shared_ptr<const ofxFontBlob>();
+    }
+    blob_registry[file_path] = blob;
+    
+    return blob;
+}
+
+std::size_t ofxFontBlob::getOpenBlobCount()
+{
+    std::lock_guard<std::mutex> lock(blob_registry_mutex);
+    
+    std::size_t count = 0;
+    for (auto &entry : blob_registry) {
+        if (!entry.second.expired()) {
+            ++count;
+        }
+    }
+    
+    return count;
+}
+
+ofxFontBlob::ofxFontBlob()
+: data_(nullptr), size_(0), modification_time_(0), table_hash_(0)
+#ifdef _WIN32
+, file_handle_(INVALID_HANDLE_VALUE), mapping_handle_(nullptr)
+#endif
+{
+    
+}
+
+ofxFontBlob::~ofxFontBlob()
+{
+#ifdef _WIN32
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_handle_) CloseHandle(mapping_handle_);
+    if (file_handle_ != INVALID_HANDLE_VALUE) CloseHandle(file_handle_);
+#else
+    if (data_) munmap(const_cast<unsigned char *>(data_), size_);
+#endif
+}
+
+const unsigned char *ofxFontBlob::getData() const
+{
+    return data_;
+}
+
+std::size_t ofxFontBlob::getSize() const
+{
+    return size_;
+}
+
+const std::string &ofxFontBlob::getFilePath() const
+{
+    return file_path_;
+}
+
+std::int64_t ofxFontBlob::getModificationTime() const
+{
+    return modification_time_;
+}
+
+std::uint64_t ofxFontBlob::getTableHash() const
+{
+    std::call_once(table_hash_flag_, [this]() {
+        table_hash_ = hashFontTables(data_, size_);
+    });
+    
+    return table_hash_;
+}
+
+int ofxFontBlob::map(const std::string &file_path)
+{
+    file_path_ = file_path;
+    
+#ifdef _WIN32
+    file_handle_ = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle_ == INVALID_HANDLE_VALUE) {
+        ofLogError("ofxFontBlob") << "map(): couldn't open \"" << file_path << "\"";
+        return -1;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_handle_, &file_size) || file_size.QuadPart == 0) {
+        ofLogError("ofxFontBlob") << "map(): \"" << file_path << "\" is empty";
+        return -2;
+    }
+    FILETIME write_time;
+    if (GetFileTime(file_handle_, nullptr, nullptr, &write_time)) {
+        modification_time_ = (static_cast<std::int64_t>(write_time.dwHighDateTime) << 32) | write_time.dwLowDateTime;
+    }
+    mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_handle_) {
+        ofLogError("ofxFontBlob") << "map(): couldn't map \"" << file_path << "\"";
+        return -3;
+    }
+    data_ = static_cast<const unsigned char *>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+        ofLogError("ofxFontBlob") << "map(): couldn't map \"" << file_path << "\"";
+        return -3;
+    }
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+#else
+    int fd = ::open(file_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        ofLogError("ofxFontBlob") << "map(): couldn't open \"" << file_path << "\"";
+        return -1;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        ofLogError("ofxFontBlob") << "map(): \"" << file_path << "\" is empty";
+        close(fd);
+        return -2;
+    }
+    
+    // Note: The mapping stays valid after the descriptor is closed
+    void *data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        ofLogError("ofxFontBlob") << "map(): couldn't map \"" << file_path << "\"";
+        return -3;
+    }
+    data_ = static_cast<const unsigned char *>(data);
+    size_ = file_stat.st_size;
+    modification_time_ = file_stat.st_mtime;
+#endif
+    
+    return 0;
+}
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ofxMixedFontUtil {
+
+// Note: A read-only memory mapping of a font file. open() returns the same blob for the same path while it is in use,
+//       and the file is unmapped when the last user releases it.
+class ofxFontBlob
+{
+public:
+    static std::shared_ptr<const ofxFontBlob> open(const std::string &file_path);
+    static std::size_t getOpenBlobCount();
+    
+    ~ofxFontBlob();
+    
+    ofxFontBlob(const ofxFontBlob &) = delete;
+    ofxFontBlob(ofxFontBlob &&) = delete;
+    ofxFontBlob &operator=(const ofxFontBlob &) = delete;
+    ofxFontBlob &operator=(ofxFontBlob &&) = delete;
+    
+    const unsigned char *getData() const;
+    std::size_t getSize() const;
+    const std::string &getFilePath() const;
+    std::int64_t getModificationTime() const; // Note: seconds since the epoch on POSIX, FILETIME on Windows
+    std::uint64_t getTableHash() const; // Note: hashFontTables(), computed on first use
+    
+private:
+    ofxFontBlob();
+    int map(const std::string &file_path);
+    
+    std::string file_path_;
+    const unsigned char *data_;
+    std::size_t size_;
+    std::int64_t modification_time_;
+    mutable std::once_flag table_hash_flag_;
+    mutable std::uint64_t table_hash_;
+#ifdef _WIN32
+    void *file_handle_;
+    void *mapping_handle_;
+#endif
+    
+};
+
+}
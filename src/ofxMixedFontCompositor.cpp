@@ -0,0 +1,247 @@
+#include "ofxMixedFontCompositor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OFX_MIXED_FONT_USE_SSE2
+#endif
+
+namespace ofxMixedFontUtil {
+
+static inline unsigned int div255(const unsigned int &value)
+{
+    unsigned int tmp = value + 128;
+    return (tmp + (tmp >> 8)) >> 8;
+}
+
+#ifdef OFX_MIXED_FONT_USE_SSE2
+static inline __m128i div255Epu16(const __m128i &value)
+{
+    __m128i tmp = _mm_add_epi16(value, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(tmp, _mm_srli_epi16(tmp, 8)), 8);
+}
+
+static inline __m128i broadcastAlphaEpi16(const __m128i &rgba)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(rgba, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+// Note: Each argument holds two pixels as 16 bits per channel
+static inline __m128i sourceOverEpi16(const __m128i &src, const __m128i &dst)
+{
+    __m128i inv_alpha = _mm_sub_epi16(_mm_set1_epi16(255), broadcastAlphaEpi16(src));
+    return _mm_add_epi16(src, div255Epu16(_mm_mullo_epi16(dst, inv_alpha)));
+}
+#endif
+
+void blendCoverageSpan(unsigned char *dst, const unsigned char *coverage, const int &coverage_stride, const int &width, const unsigned char *premultiplied_rgba)
+{
+    int x = 0;
+    
+#ifdef OFX_MIXED_FONT_USE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i color = _mm_unpacklo_epi8(_mm_set1_epi32(*reinterpret_cast<const int *>(premultiplied_rgba)), zero);
+    for (; x + 4 <= width; x += 4) {
+        const unsigned char *cov = coverage + x * coverage_stride;
+        __m128i cov4 = _mm_setr_epi16(cov[0], cov[coverage_stride], cov[coverage_stride * 2], cov[coverage_stride * 3], 0, 0, 0, 0);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(cov4, zero)) == 0xFFFF) {
+            continue;
+        }
+        
+        __m128i cov_pairs = _mm_unpacklo_epi16(cov4, cov4);
+        __m128i cov_lo = _mm_unpacklo_epi32(cov_pairs, cov_pairs);
+        __m128i cov_hi = _mm_unpackhi_epi32(cov_pairs, cov_pairs);
+        
+        __m128i *dst_ptr = reinterpret_cast<__m128i *>(dst + x * 4);
+        __m128i dst4 = _mm_loadu_si128(dst_ptr);
+        __m128i src_lo = div255Epu16(_mm_mullo_epi16(color, cov_lo));
+        __m128i src_hi = div255Epu16(_mm_mullo_epi16(color, cov_hi));
+        __m128i out_lo = sourceOverEpi16(src_lo, _mm_unpacklo_epi8(dst4, zero));
+        __m128i out_hi = sourceOverEpi16(src_hi, _mm_unpackhi_epi8(dst4, zero));
+        _mm_storeu_si128(dst_ptr, _mm_packus_epi16(out_lo, out_hi));
+    }
+#endif
+    
+    for (; x < width; ++x) {
+        unsigned int cov = coverage[x * coverage_stride];
+        if (cov == 0) {
+            continue;
+        }
+        
+        unsigned char *px = dst + x * 4;
+        unsigned int src_alpha = div255(premultiplied_rgba[3] * cov);
+        unsigned int inv_alpha = 255 - src_alpha;
+        for (int c = 0; c < 3; ++c) {
+            px[c] = div255(premultiplied_rgba[c] * cov) + div255(px[c] * inv_alpha);
+        }
+        px[3] = src_alpha + div255(px[3] * inv_alpha);
+    }
+}
+
+void blendPremultipliedBGRASpan(unsigned char *dst, const unsigned char *src_bgra, const int &width)
+{
+    int x = 0;
+    
+#ifdef OFX_MIXED_FONT_USE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 4 <= width; x += 4) {
+        __m128i src4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src_bgra + x * 4));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(src4, zero)) == 0xFFFF) {
+            continue;
+        }
+        
+        // Note: BGRA -> RGBA
+        __m128i src_lo = _mm_unpacklo_epi8(src4, zero);
+        __m128i src_hi = _mm_unpackhi_epi8(src4, zero);
+        src_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_lo, _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2));
+        src_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src_hi, _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2));
+        
+        __m128i *dst_ptr = reinterpret_cast<__m128i *>(dst + x * 4);
+        __m128i dst4 = _mm_loadu_si128(dst_ptr);
+        __m128i out_lo = sourceOverEpi16(src_lo, _mm_unpacklo_epi8(dst4, zero));
+        __m128i out_hi = sourceOverEpi16(src_hi, _mm_unpackhi_epi8(dst4, zero));
+        _mm_storeu_si128(dst_ptr, _mm_packus_epi16(out_lo, out_hi));
+    }
+#endif
+    
+    for (; x < width; ++x) {
+        const unsigned char *src = src_bgra + x * 4;
+        if (src[3] == 0 && src[0] == 0 && src[1] == 0 && src[2] == 0) {
+            continue;
+        }
+        
+        unsigned char *px = dst + x * 4;
+        unsigned int inv_alpha = 255 - src[3];
+        px[0] = src[2] + div255(px[0] * inv_alpha);
+        px[1] = src[1] + div255(px[1] * inv_alpha);
+        px[2] = src[0] + div255(px[2] * inv_alpha);
+        px[3] = src[3] + div255(px[3] * inv_alpha);
+    }
+}
+
+void unpremultiplyRGBA(unsigned char *pixels, const std::size_t &num_pixels)
+{
+    for (std::size_t i = 0; i < num_pixels; ++i) {
+        unsigned char *px = pixels + i * 4;
+        unsigned int alpha = px[3];
+        if (alpha == 0 || alpha == 255) {
+            continue;
+        }
+        
+        for (int c = 0; c < 3; ++c) {
+            unsigned int value = (px[c] * 255 + alpha / 2) / alpha;
+            px[c] = (value > 255) ? 255 : value;
+        }
+    }
+}
+
+class CompositionThreadPool
+{
+public:
+    CompositionThreadPool()
+    : stop_(false), job_id_(0)
+    {
+        unsigned int num_threads = std::thread::hardware_concurrency();
+        for (unsigned int i = 1; i < num_threads; ++i) {
+            workers_.emplace_back([this]() { run(); });
+        }
+    };
+    
+    ~CompositionThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_up_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    };
+    
+    void execute(const int &count, const std::function<void (const int &index)> &func)
+    {
+        if (workers_.empty() || count <= 1) {
+            for (int i = 0; i < count; ++i) {
+                func(i);
+            }
+            return;
+        }
+        
+        std::lock_guard<std::mutex> execute_lock(execute_mutex_);
+        std::shared_ptr<Job> job = std::make_shared<Job>(count, func);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = job;
+            ++job_id_;
+        }
+        wake_up_.notify_all();
+        
+        work(*job);
+        
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait(lock, [&job]() { return job->num_finished.load() == job->count; });
+        job_.reset();
+    };
+    
+private:
+    struct Job {
+        Job(const int &count_, const std::function<void (const int &index)> &func_) : count(count_), func(func_), next_index(0), num_finished(0) {};
+        const int count;
+        const std::function<void (const int &index)> &func;
+        std::atomic<int> next_index;
+        std::atomic<int> num_finished;
+    };
+    
+    void work(Job &job)
+    {
+        for (int index = job.next_index++; index < job.count; index = job.next_index++) {
+            job.func(index);
+            if (++job.num_finished == job.count) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                finished_.notify_all();
+            }
+        }
+    };
+    
+    void run()
+    {
+        unsigned long long last_job_id = 0;
+        while (true) {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_up_.wait(lock, [&]() { return stop_ || (job_ && job_id_ != last_job_id); });
+                if (stop_) {
+                    return;
+                }
+                last_job_id = job_id_;
+                job = job_;
+            }
+            work(*job);
+        }
+    };
+    
+    std::vector<std::thread> workers_;
+    std::mutex execute_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_up_;
+    std::condition_variable finished_;
+    std::shared_ptr<Job> job_;
+    bool stop_;
+    unsigned long long job_id_;
+};
+
+void parallelFor(const int &count, const std::function<void (const int &index)> &func)
+{
+    static CompositionThreadPool thread_pool;
+    thread_pool.execute(count, func);
+}
+
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ofxMixedFontUtil {
+
+// Note: Destination pixels are premultiplied RGBA (8 bits per channel)
+void blendCoverageSpan(unsigned char *dst, const unsigned char *coverage, const int &coverage_stride, const int &width, const unsigned char *premultiplied_rgba);
+void blendPremultipliedBGRASpan(unsigned char *dst, const unsigned char *src_bgra, const int &width);
+void unpremultiplyRGBA(unsigned char *pixels, const std::size_t &num_pixels);
+
+// Note: Runs func(0) ... func(count - 1) on a shared thread pool, and returns when all of them have finished
+void parallelFor(const int &count, const std::function<void (const int &index)> &func);
+
+}
@@ -0,0 +1,81 @@
+#include "ofxMixedFontGraphemeBreak.hpp"
+#include "ofxMixedFontGraphemeBreakTable.hpp"
+
+namespace ofxMixedFontUtil {
+
+static const unsigned char EXTENDED_PICTOGRAPHIC_FLAG = 0x10;
+
+static unsigned char GetGraphemeBreakProperty(const char32_t &code_point)
+{
+    if (code_point > GRAPHEME_BREAK_MAX_CODE_POINT) {
+        return GCB_OTHER;
+    }
+    
+    const int block = GRAPHEME_BREAK_STAGE1[code_point >> GRAPHEME_BREAK_SHIFT];
+    return GRAPHEME_BREAK_STAGE2[(block << GRAPHEME_BREAK_SHIFT) | (code_point & GRAPHEME_BREAK_MASK)];
+}
+
+ofxGraphemeClusterBreak getGraphemeClusterBreak(const char32_t &code_point)
+{
+    return static_cast<ofxGraphemeClusterBreak>(GetGraphemeBreakProperty(code_point) & ~EXTENDED_PICTOGRAPHIC_FLAG);
+}
+
+bool isExtendedPictographic(const char32_t &code_point)
+{
+    return (GetGraphemeBreakProperty(code_point) & EXTENDED_PICTOGRAPHIC_FLAG) != 0;
+}
+
+int getGraphemeClusterLength(const std::u32string &utf32_string, const int &index)
+{
+    const int length = utf32_string.length();
+    if (index < 0 || length <= index) {
+        return 0;
+    }
+    
+    unsigned char property = GetGraphemeBreakProperty(utf32_string[index]);
+    ofxGraphemeClusterBreak previous = static_cast<ofxGraphemeClusterBreak>(property & ~EXTENDED_PICTOGRAPHIC_FLAG);
+    bool follows_pictographic = (property & EXTENDED_PICTOGRAPHIC_FLAG) != 0; // Note: ExtPict Extend*
+    bool follows_pictographic_zwj = false; // Note: ExtPict Extend* ZWJ
+    int regional_indicator_count = (previous == GCB_REGIONAL_INDICATOR) ? 1 : 0;
+    
+    int end = index + 1;
+    for (; end < length; ++end) {
+        property = GetGraphemeBreakProperty(utf32_string[end]);
+        const ofxGraphemeClusterBreak current = static_cast<ofxGraphemeClusterBreak>(property & ~EXTENDED_PICTOGRAPHIC_FLAG);
+        const bool is_pictographic = (property & EXTENDED_PICTOGRAPHIC_FLAG) != 0;
+        
+        bool is_boundary = true;
+        if (previous == GCB_CR && current == GCB_LF) {
+            is_boundary = false; // Note: GB3
+        }
+        else if (previous == GCB_CONTROL || previous == GCB_CR || previous == GCB_LF
+                 || current == GCB_CONTROL || current == GCB_CR || current == GCB_LF) {
+            is_boundary = true; // Note: GB4, GB5
+        }
+        else if ((previous == GCB_L && (current == GCB_L || current == GCB_V || current == GCB_LV || current == GCB_LVT))
+                 || ((previous == GCB_LV || previous == GCB_V) && (current == GCB_V || current == GCB_T))
+                 || ((previous == GCB_LVT || previous == GCB_T) && current == GCB_T)) {
+            is_boundary = false; // Note: GB6 - GB8
+        }
+        else if (current == GCB_EXTEND || current == GCB_ZWJ || current == GCB_SPACING_MARK || previous == GCB_PREPEND) {
+            is_boundary = false; // Note: GB9 - GB9b
+        }
+        else if (follows_pictographic_zwj && is_pictographic) {
+            is_boundary = false; // Note: GB11
+        }
+        else if (previous == GCB_REGIONAL_INDICATOR && current == GCB_REGIONAL_INDICATOR && (regional_indicator_count % 2) == 1) {
+            is_boundary = false; // Note: GB12, GB13
+        }
+        
+        if (is_boundary) break;
+        
+        follows_pictographic_zwj = (follows_pictographic && current == GCB_ZWJ);
+        follows_pictographic = is_pictographic || (follows_pictographic && current == GCB_EXTEND);
+        regional_indicator_count = (current == GCB_REGIONAL_INDICATOR) ? regional_indicator_count + 1 : 0;
+        previous = current;
+    }
+    
+    return end - index;
+}
+
+}
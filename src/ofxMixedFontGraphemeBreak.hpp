@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+namespace ofxMixedFontUtil {
+
+// Note: UAX #29 Grapheme_Cluster_Break values. Keep the order in sync with scripts/generate_unicode_tables.py
+typedef enum : unsigned char {
+    GCB_OTHER, GCB_CR, GCB_LF, GCB_CONTROL, GCB_EXTEND, GCB_ZWJ, GCB_REGIONAL_INDICATOR, GCB_PREPEND, GCB_SPACING_MARK,
+    GCB_L, GCB_V, GCB_T, GCB_LV, GCB_LVT,
+} ofxGraphemeClusterBreak;
+
+ofxGraphemeClusterBreak getGraphemeClusterBreak(const char32_t &code_point);
+bool isExtendedPictographic(const char32_t &code_point);
+
+// Note: Returns the number of code points of the extended grapheme cluster which starts at index
+//       (ex. emoji ZWJ sequences, flags, keycaps and emoji with skin tone modifiers)
+int getGraphemeClusterLength(const std::u32string &utf32_string, const int &index);
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace ofxMixedFontUtil {
+
+typedef struct {
+    std::size_t hits;
+    std::size_t misses;
+    std::size_t size;
+    std::size_t capacity;
+} ofxCacheStats;
+
+inline std::size_t combineHash(const std::size_t &seed, const std::size_t &value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+// Note: Entries are indexed by a precomputed hash, and Key is compared only on a hash match.
+//       So a lookup with a Key-comparable object never copies the key.
+template<typename Key, typename Value>
+class ofxLRUCache
+{
+public:
+    explicit ofxLRUCache(const std::size_t &capacity)
+    : capacity_(capacity), hits_(0), misses_(0)
+    {
+        
+    };
+    
+    template<typename KeyLike>
+    const Value *find(const std::size_t &hash, const KeyLike &key)
+    {
+        auto found = index_.find(hash);
+        if (found == index_.end() || !(found->second->key == key)) {
+            ++misses_;
+            return nullptr;
+        }
+        
+        entries_.splice(entries_.begin(), entries_, found->second);
+        ++hits_;
+        return &found->second->value;
+    };
+    
+    void insert(const std::size_t &hash, const Key &key, const Value &value)
+    {
+        if (capacity_ == 0) return;
+        
+        auto found = index_.find(hash);
+        if (found != index_.end()) {
+            entries_.erase(found->second);
+            index_.erase(found);
+        }
+        while (entries_.size() >= capacity_) {
+            index_.erase(entries_.back().hash);
+            entries_.pop_back();
+        }
+        
+        entries_.push_front(Entry{ hash, key, value });
+        index_[hash] = entries_.begin();
+    };
+    
+    void clear()
+    {
+        entries_.clear();
+        index_.clear();
+    };
+    
+    void setCapacity(const std::size_t &capacity)
+    {
+        capacity_ = capacity;
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().hash);
+            entries_.pop_back();
+        }
+    };
+    
+    ofxCacheStats getStats() const
+    {
+        ofxCacheStats stats = { hits_, misses_, entries_.size(), capacity_ };
+        return stats;
+    };
+    
+private:
+    struct Entry {
+        std::size_t hash;
+        Key key;
+        Value value;
+    };
+    
+    std::list<Entry> entries_;
+    std::unordered_map<std::size_t, typename std::list<Entry>::iterator> index_;
+    std::size_t capacity_;
+    std::size_t hits_;
+    std::size_t misses_;
+};
+
+}
@@ -0,0 +1,272 @@
+#include "ofxMixedFontLineBreak.hpp"
+#include "ofxMixedFontLineBreakTable.hpp"
+
+namespace ofxMixedFontUtil {
+
+// Note: Keep the values in sync with scripts/generate_unicode_tables.py
+static const unsigned char EAST_ASIAN_FLAG = 0x40; // Note: East_Asian_Width F, W or H
+static const unsigned char RESERVED_PICTOGRAPHIC_FLAG = 0x80; // Note: unassigned Extended_Pictographic
+static const unsigned char LINE_BREAK_FLAGS = EAST_ASIAN_FLAG | RESERVED_PICTOGRAPHIC_FLAG;
+
+static unsigned char GetLineBreakProperty(const char32_t &code_point)
+{
+    if (code_point > LINE_BREAK_MAX_CODE_POINT) {
+        return LB_XX;
+    }
+    
+    const int block = LINE_BREAK_STAGE1[code_point >> LINE_BREAK_SHIFT];
+    return LINE_BREAK_STAGE2[(block << LINE_BREAK_SHIFT) | (code_point & LINE_BREAK_MASK)];
+}
+
+static ofxLineBreakClass ResolveLineBreakClass(const ofxLineBreakClass &line_break_class)
+{
+    // Note: LB1 (CJ is resolved to NS for strict kinsoku shori; dictionary based breaking of SA is not supported)
+    switch (line_break_class) {
+        case LB_AI:
+        case LB_SG:
+        case LB_XX:
+        case LB_SA:
+            return LB_AL;
+        case LB_CJ:
+            return LB_NS;
+        default:
+            return line_break_class;
+    }
+}
+
+static bool IsHardBreakClass(const ofxLineBreakClass &line_break_class)
+{
+    return (line_break_class == LB_BK || line_break_class == LB_CR || line_break_class == LB_LF || line_break_class == LB_NL);
+}
+
+static bool IsAlphabeticClass(const ofxLineBreakClass &line_break_class)
+{
+    return (line_break_class == LB_AL || line_break_class == LB_HL);
+}
+
+ofxLineBreakClass getLineBreakClass(const char32_t &code_point)
+{
+    return static_cast<ofxLineBreakClass>(GetLineBreakProperty(code_point) & ~LINE_BREAK_FLAGS);
+}
+
+ofxLineBreaker::ofxLineBreaker()
+{
+    reset();
+}
+
+void ofxLineBreaker::reset()
+{
+    is_first_ = true;
+    prev_class_ = LB_XX;
+    prev_flags_ = 0;
+    class_before_spaces_ = LB_XX;
+    zw_is_pending_ = false;
+    prev_is_zwj_ = false;
+    prev_is_hl_hyphen_ = false;
+    ri_count_ = 0;
+}
+
+ofxBreakAction ofxLineBreaker::next(const char32_t &code_point)
+{
+    const unsigned char property = GetLineBreakProperty(code_point);
+    return next(static_cast<ofxLineBreakClass>(property & ~LINE_BREAK_FLAGS), property & LINE_BREAK_FLAGS);
+}
+
+ofxBreakAction ofxLineBreaker::next(const ofxLineBreakClass &line_break_class)
+{
+    return next(line_break_class, 0);
+}
+
+ofxBreakAction ofxLineBreaker::next(const ofxLineBreakClass &line_break_class, const unsigned char &flags)
+{
+    ofxLineBreakClass current = ResolveLineBreakClass(line_break_class);
+    const bool is_combining = (current == LB_CM || current == LB_ZWJ);
+    
+    ofxBreakAction action = BREAK_PROHIBITED;
+    if (is_first_) {
+        // Note: LB10 (CM at the start of text is treated as AL)
+        if (is_combining) current = LB_AL;
+        is_first_ = false;
+    }
+    else if (prev_class_ == LB_BK || prev_class_ == LB_LF || prev_class_ == LB_NL || (prev_class_ == LB_CR && current != LB_LF)) {
+        // Note: LB4, LB5
+        action = BREAK_MANDATORY;
+        if (is_combining) current = LB_AL;
+    }
+    else if (IsHardBreakClass(current) || current == LB_SP || current == LB_ZW) {
+        // Note: LB6, LB7
+        action = BREAK_PROHIBITED;
+    }
+    else if (zw_is_pending_) {
+        // Note: LB8
+        action = BREAK_ALLOWED;
+        if (is_combining) current = LB_AL;
+    }
+    else if (is_combining && prev_class_ != LB_SP && prev_class_ != LB_ZW) {
+        // Note: LB9 (X CM* is treated as X, so the state is left as it is)
+        prev_is_zwj_ = (current == LB_ZWJ);
+        return BREAK_PROHIBITED;
+    }
+    else if (prev_is_zwj_) {
+        // Note: LB8a
+        action = BREAK_PROHIBITED;
+        if (is_combining) current = LB_AL;
+    }
+    else {
+        // Note: LB10
+        if (is_combining) current = LB_AL;
+        action = getPairAction(current, flags);
+    }
+    
+    if (current == LB_SP) {
+        if (prev_class_ != LB_SP) class_before_spaces_ = prev_class_;
+    }
+    else {
+        class_before_spaces_ = current;
+    }
+    zw_is_pending_ = (current == LB_ZW || (zw_is_pending_ && current == LB_SP));
+    ri_count_ = (current == LB_RI) ? ri_count_ + 1 : 0;
+    prev_is_hl_hyphen_ = (prev_class_ == LB_HL && (current == LB_HY || current == LB_BA));
+    prev_is_zwj_ = false;
+    prev_class_ = current;
+    prev_flags_ = is_combining ? 0 : flags;
+    
+    return action;
+}
+
+ofxBreakAction ofxLineBreaker::getPairAction(const ofxLineBreakClass &current, const unsigned char &flags) const
+{
+    const ofxLineBreakClass prev = prev_class_;
+    const ofxLineBreakClass before_spaces = class_before_spaces_;
+    
+    // Note: LB11, LB12, LB12a
+    if (current == LB_WJ || prev == LB_WJ || prev == LB_GL) return BREAK_PROHIBITED;
+    if (current == LB_GL && prev != LB_SP && prev != LB_BA && prev != LB_HY) return BREAK_PROHIBITED;
+    
+    // Note: LB13 (kinsoku shori for the beginning of a line)
+    if (current == LB_CL || current == LB_CP || current == LB_EX || current == LB_IS || current == LB_SY) return BREAK_PROHIBITED;
+    
+    // Note: LB14 - LB17 (kinsoku shori for the end of a line, OP SP* ×)
+    if (before_spaces == LB_OP) return BREAK_PROHIBITED;
+    if (before_spaces == LB_QU && current == LB_OP) return BREAK_PROHIBITED;
+    if ((before_spaces == LB_CL || before_spaces == LB_CP) && current == LB_NS) return BREAK_PROHIBITED;
+    if (before_spaces == LB_B2 && current == LB_B2) return BREAK_PROHIBITED;
+    
+    // Note: LB18
+    if (prev == LB_SP) return BREAK_ALLOWED;
+    
+    // Note: LB19, LB20
+    if (current == LB_QU || prev == LB_QU) return BREAK_PROHIBITED;
+    if (current == LB_CB || prev == LB_CB) return BREAK_ALLOWED;
+    
+    // Note: LB21, LB21a, LB21b, LB22
+    if (current == LB_BA || current == LB_HY || current == LB_NS || prev == LB_BB) return BREAK_PROHIBITED;
+    if (prev_is_hl_hyphen_) return BREAK_PROHIBITED;
+    if (prev == LB_SY && current == LB_HL) return BREAK_PROHIBITED;
+    if (current == LB_IN) return BREAK_PROHIBITED;
+    
+    // Note: LB23 - LB25 (numbers)
+    if (IsAlphabeticClass(prev) && current == LB_NU) return BREAK_PROHIBITED;
+    if (prev == LB_NU && IsAlphabeticClass(current)) return BREAK_PROHIBITED;
+    if (prev == LB_PR && (current == LB_ID || current == LB_EB || current == LB_EM)) return BREAK_PROHIBITED;
+    if ((prev == LB_ID || prev == LB_EB || prev == LB_EM) && current == LB_PO) return BREAK_PROHIBITED;
+    if ((prev == LB_PR || prev == LB_PO) && IsAlphabeticClass(current)) return BREAK_PROHIBITED;
+    if (IsAlphabeticClass(prev) && (current == LB_PR || current == LB_PO)) return BREAK_PROHIBITED;
+    if ((prev == LB_PR || prev == LB_PO) && current == LB_OP) return BREAK_PROHIBITED;
+    if ((prev == LB_PR || prev == LB_PO || prev == LB_OP || prev == LB_HY || prev == LB_SY || prev == LB_IS) && current == LB_NU) return BREAK_PROHIBITED;
+    if (prev == LB_NU && (current == LB_NU || current == LB_PO || current == LB_PR)) return BREAK_PROHIBITED;
+    if ((prev == LB_CL || prev == LB_CP) && (current == LB_PO || current == LB_PR)) return BREAK_PROHIBITED;
+    
+    // Note: LB26, LB27 (Korean syllable blocks)
+    if (prev == LB_JL && (current == LB_JL || current == LB_JV || current == LB_H2 || current == LB_H3)) return BREAK_PROHIBITED;
+    if ((prev == LB_JV || prev == LB_H2) && (current == LB_JV || current == LB_JT)) return BREAK_PROHIBITED;
+    if ((prev == LB_JT || prev == LB_H3) && current == LB_JT) return BREAK_PROHIBITED;
+    const bool prev_is_korean = (prev == LB_JL || prev == LB_JV || prev == LB_JT || prev == LB_H2 || prev == LB_H3);
+    const bool current_is_korean = (current == LB_JL || current == LB_JV || current == LB_JT || current == LB_H2 || current == LB_H3);
+    if ((prev_is_korean && current == LB_PO) || (prev == LB_PR && current_is_korean)) return BREAK_PROHIBITED;
+    
+    // Note: LB28 - LB30b (LB30 doesn't apply to East Asian brackets)
+    if (IsAlphabeticClass(prev) && IsAlphabeticClass(current)) return BREAK_PROHIBITED;
+    if (prev == LB_IS && IsAlphabeticClass(current)) return BREAK_PROHIBITED;
+    if ((IsAlphabeticClass(prev) || prev == LB_NU) && current == LB_OP && !(flags & EAST_ASIAN_FLAG)) return BREAK_PROHIBITED;
+    if (prev == LB_CP && !(prev_flags_ & EAST_ASIAN_FLAG) && (IsAlphabeticClass(current) || current == LB_NU)) return BREAK_PROHIBITED;
+    if (prev == LB_RI && current == LB_RI && (ri_count_ % 2) == 1) return BREAK_PROHIBITED;
+    if ((prev == LB_EB || (prev_flags_ & RESERVED_PICTOGRAPHIC_FLAG)) && current == LB_EM) return BREAK_PROHIBITED;
+    
+    // Note: LB31
+    return BREAK_ALLOWED;
+}
+
+void wrapGlyphList(const ofxFontProps &font_props, const ofPoint &coord, const float &max_width, std::vector<ofxGlyphData> &glyph_list)
+{
+    ofxLineBreaker breaker;
+    ofPoint pos = coord;
+    int line_begin = 0;
+    int last_break = -1;
+    
+    for (int i = 0; i < glyph_list.size(); ++i) {
+        auto &glyph = glyph_list[i];
+        const std::u32string &code_point = glyph.props.code_point;
+        
+        // Note: Glyphs made of several characters (ligatures, clusters) are classified by the first one
+        ofxBreakAction action = BREAK_PROHIBITED;
+        ofxLineBreakClass line_break_class = LB_XX;
+        if (!code_point.empty()) {
+            line_break_class = ResolveLineBreakClass(getLineBreakClass(code_point[0]));
+            action = breaker.next(code_point[0]);
+            for (int j = 1; j < code_point.size(); ++j) {
+                breaker.next(code_point[j]);
+            }
+        }
+        
+        if (action == BREAK_ALLOWED && i > line_begin) {
+            last_break = i;
+        }
+        
+        glyph.coord = pos;
+        
+        if (IsHardBreakClass(line_break_class)) {
+            reorderGlyphsByBidiLevels(font_props, glyph_list, line_begin, i + 1);
+            pos.x = coord.x;
+            pos.y += font_props.line_height;
+            line_begin = i + 1;
+            last_break = -1;
+            continue;
+        }
+        
+        const float advance = getGlyphAdvance(font_props, glyph.props);
+        
+        // Note: Trailing spaces are allowed to hang over the right edge
+        if (line_break_class != LB_SP && line_break_class != LB_ZW && pos.x + advance > coord.x + max_width && i > line_begin) {
+            if (last_break > line_begin) {
+                reorderGlyphsByBidiLevels(font_props, glyph_list, line_begin, last_break);
+                const float shift = glyph_list[last_break].coord.x - coord.x;
+                for (int j = last_break; j <= i; ++j) {
+                    glyph_list[j].coord.x -= shift;
+                    glyph_list[j].coord.y += font_props.line_height;
+                }
+                line_begin = last_break;
+                pos.x -= shift;
+            }
+            else {
+                reorderGlyphsByBidiLevels(font_props, glyph_list, line_begin, i);
+                glyph.coord.x = coord.x;
+                glyph.coord.y += font_props.line_height;
+                line_begin = i;
+                pos.x = coord.x;
+            }
+            pos.y += font_props.line_height;
+            last_break = -1;
+        }
+        
+        pos.x += advance;
+    }
+    reorderGlyphsByBidiLevels(font_props, glyph_list, line_begin, glyph_list.size());
+}
+
+ofxCompFunc makeWrappingCompFunc(const float &max_width)
+{
+    return ofxWrappingCompPolicy{ max_width };
+}
+
+}
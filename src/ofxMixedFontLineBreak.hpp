@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ofxMixedFontUtil.hpp"
+
+namespace ofxMixedFontUtil {
+
+// Note: UAX #14 line breaking classes (LineBreak.txt). Keep the order in sync with scripts/generate_unicode_tables.py
+typedef enum : unsigned char {
+    LB_XX, LB_BK, LB_CR, LB_LF, LB_NL, LB_SP, LB_ZW, LB_WJ, LB_GL, LB_CM, LB_ZWJ,
+    LB_OP, LB_CL, LB_CP, LB_QU, LB_NS, LB_EX, LB_SY, LB_IS, LB_PR, LB_PO, LB_NU,
+    LB_AL, LB_HL, LB_ID, LB_IN, LB_HY, LB_BA, LB_BB, LB_B2, LB_CJ, LB_RI, LB_EB,
+    LB_EM, LB_H2, LB_H3, LB_JL, LB_JV, LB_JT, LB_SA, LB_CB, LB_AI, LB_SG,
+} ofxLineBreakClass;
+
+typedef enum {
+    BREAK_PROHIBITED,
+    BREAK_ALLOWED,
+    BREAK_MANDATORY,
+} ofxBreakAction;
+
+ofxLineBreakClass getLineBreakClass(const char32_t &code_point);
+
+// Note: Feed characters in logical order. next() returns the break action before the given character.
+//       The rules of UAX #14 (Unicode 14.0) are followed with these tailorings and limits:
+//       - LB1: AI, SG and XX are AL, CJ is NS (strict kinsoku shori), and SA is AL, since dictionary based breaking is not supported
+//       - LB25: the pair rules, not the regular expression of the tailoring example
+//       - LB30, LB30b: next(line_break_class) doesn't know East_Asian_Width or whether the character is unassigned,
+//         so the character is treated as a narrow, assigned one
+class ofxLineBreaker
+{
+public:
+    ofxLineBreaker();
+    
+    void reset();
+    ofxBreakAction next(const char32_t &code_point);
+    ofxBreakAction next(const ofxLineBreakClass &line_break_class);
+    
+private:
+    ofxBreakAction next(const ofxLineBreakClass &line_break_class, const unsigned char &flags);
+    ofxBreakAction getPairAction(const ofxLineBreakClass &line_break_class, const unsigned char &flags) const;
+    
+    bool is_first_;
+    ofxLineBreakClass prev_class_;
+    unsigned char prev_flags_;
+    ofxLineBreakClass class_before_spaces_;
+    bool zw_is_pending_;
+    bool prev_is_zwj_;
+    bool prev_is_hl_hyphen_; // Note: HL (HY | BA)
+    int ri_count_;
+};
+
+// Note: Lines are broken at UAX #14 break opportunities (including Japanese kinsoku shori) so that
+//       they fit in max_width. A word longer than max_width is broken at the glyph which overflows.
+void wrapGlyphList(const ofxFontProps &font_props, const ofPoint &coord, const float &max_width, std::vector<ofxGlyphData> &glyph_list);
+ofxCompFunc makeWrappingCompFunc(const float &max_width);
+
+struct ofxWrappingCompPolicy
+{
+    float max_width;
+    
+    void operator()(const std::shared_ptr<ofxBaseFont> &font, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list) const
+    {
+        wrapGlyphList(font->getFontProps(), coord, max_width, glyph_list);
+    }
+};
+
+}
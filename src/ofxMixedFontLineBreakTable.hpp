@@ -0,0 +1,1298 @@
+#pragma once
+
+// Note: Generated by scripts/generate_unicode_tables.py. Do not edit.
+//       UNICODE_VERSION 14.0.0
+
+namespace ofxMixedFontUtil {
+
+static const int LINE_BREAK_SHIFT = 7;
+static const int LINE_BREAK_MASK = 127;
+static const char32_t LINE_BREAK_MAX_CODE_POINT = 0x10FFFF;
+
+static const unsigned char LINE_BREAK_STAGE1[8704] = {
+    0,1,2,2,2,3,4,5,2,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,
+    29,30,31,32,33,34,35,36,37,2,2,2,2,38,39,40,41,42,43,44,45,46,47,48,49,50,2,51,2,2,52,53,
+    54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,2,2,2,70,2,2,71,72,2,73,74,75,76,77,78,79,
+    80,81,82,83,84,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,85,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    86,78,78,78,78,78,78,78,78,87,2,2,88,89,2,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,99,
+    100,101,102,103,104,105,99,100,101,102,103,104,105,99,100,101,102,103,104,105,99,100,101,102,103,104,105,99,100,101,102,103,
+    104,105,99,100,101,102,103,104,105,99,100,101,102,103,104,105,99,100,101,102,103,104,105,99,100,101,102,103,104,105,99,100,
+    101,102,103,104,105,99,100,101,102,103,104,105,99,100,101,106,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,107,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,78,78,78,78,109,110,2,2,111,112,113,114,115,116,
+    117,118,119,120,121,122,123,124,2,125,126,127,2,2,128,129,130,131,132,133,134,135,136,137,138,139,140,121,141,142,143,144,
+    145,146,147,148,149,150,151,121,152,153,121,154,155,156,157,121,158,159,160,161,162,163,121,121,164,165,166,167,121,168,121,169,
+    2,2,2,2,2,2,2,170,171,2,172,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,173,
+    2,2,2,2,174,175,176,2,177,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,2,2,2,178,179,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,2,2,2,2,180,181,182,183,121,121,121,121,184,185,186,187,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,188,78,78,78,78,78,78,189,189,189,190,191,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,192,
+    78,78,193,78,78,194,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,195,196,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,197,172,
+    2,198,199,200,201,202,203,121,204,205,206,2,2,207,2,208,2,2,2,2,209,210,121,121,121,121,121,121,121,121,211,121,
+    212,121,213,121,121,214,121,121,121,121,121,121,121,121,121,215,2,216,217,121,121,121,121,121,218,219,220,121,221,222,121,121,
+    223,224,225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,2,245,228,228,228,228,228,228,228,246,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,247,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+    78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,247,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    248,121,249,250,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,121,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,251,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,
+    108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,108,251,
+};
+
+static const unsigned char LINE_BREAK_STAGE2[32256] = {
+    9,9,9,9,9,9,9,9,9,27,3,1,1,2,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    5,16,14,22,19,20,22,14,11,13,22,19,18,26,18,17,21,21,21,21,21,21,21,21,21,21,18,18,22,22,22,16,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,19,13,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,27,12,22,9,
+    9,9,9,9,9,4,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    8,11,20,19,19,19,22,41,41,22,41,14,22,27,22,22,20,19,41,41,28,22,41,41,41,41,41,14,41,41,41,11,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,41,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,41,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,41,28,41,41,41,28,41,22,22,41,22,22,22,22,22,22,22,41,41,41,41,22,41,22,28,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,8,9,9,9,9,9,9,9,9,9,9,9,9,8,8,8,8,
+    8,8,8,9,9,9,9,9,9,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,64,64,22,22,22,22,18,22,
+    64,64,64,64,22,22,22,22,22,22,22,64,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,18,27,64,64,22,22,19,64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,27,9,
+    22,9,9,22,9,9,16,9,64,64,64,64,64,64,64,64,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+    23,23,23,23,23,23,23,23,23,23,23,64,64,64,64,23,23,23,23,22,22,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,20,20,20,18,18,22,22,9,9,9,9,9,9,9,9,9,9,9,16,9,16,16,16,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    21,21,21,21,21,21,21,21,21,21,20,21,21,22,22,22,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,16,22,9,9,9,9,9,9,9,22,22,9,
+    9,9,9,9,9,22,22,9,9,22,9,9,9,9,22,22,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,22,22,22,22,18,16,22,64,64,9,19,19,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,22,9,9,9,9,9,
+    9,9,9,9,22,9,9,9,22,9,9,9,9,9,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,64,64,22,64,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,64,64,64,64,64,64,9,9,9,9,9,9,9,9,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,22,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,22,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,
+    22,22,9,9,27,27,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,9,9,9,64,22,22,22,22,22,22,22,22,64,64,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,64,64,64,22,22,22,22,64,64,9,22,9,9,
+    9,9,9,9,9,64,64,9,9,64,64,9,9,9,22,64,64,64,64,64,64,64,64,9,64,64,64,64,22,22,64,22,
+    22,22,9,9,64,64,21,21,21,21,21,21,21,21,21,21,22,22,20,20,22,22,22,22,22,20,22,19,22,22,9,64,
+    64,9,9,9,64,22,22,22,22,22,22,64,64,64,64,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,64,22,22,64,22,22,64,64,9,64,9,9,
+    9,9,9,64,64,64,64,9,9,64,64,9,9,9,64,64,64,9,64,64,64,64,64,64,64,22,22,22,22,64,22,64,
+    64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,9,9,22,22,22,9,22,64,64,64,64,64,64,64,64,64,
+    64,9,9,9,64,22,22,22,22,22,22,22,22,22,64,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,64,22,22,22,22,22,64,64,9,22,9,9,
+    9,9,9,9,9,9,64,9,9,9,64,9,9,9,64,64,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,9,9,64,64,21,21,21,21,21,21,21,21,21,21,22,19,64,64,64,64,64,64,64,22,9,9,9,9,9,9,
+    64,9,9,9,64,22,22,22,22,22,22,22,22,64,64,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,64,22,22,22,22,22,64,64,9,22,9,9,
+    9,9,9,9,9,64,64,9,9,64,64,9,9,9,64,64,64,64,64,64,64,9,9,9,64,64,64,64,22,22,64,22,
+    22,22,9,9,64,64,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,
+    64,64,9,22,64,22,22,22,22,22,22,64,64,64,22,22,22,64,22,22,22,22,64,64,64,22,22,64,22,64,22,22,
+    64,64,64,22,22,64,64,64,22,22,22,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,9,9,
+    9,9,9,64,64,64,9,9,9,64,9,9,9,9,64,64,22,64,64,64,64,64,64,9,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,19,22,64,64,64,64,64,
+    9,9,9,9,9,22,22,22,22,22,22,22,22,64,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,9,22,9,9,
+    9,9,9,9,9,64,9,9,9,64,9,9,9,9,64,64,64,64,64,64,64,9,9,64,22,22,22,64,64,22,64,64,
+    22,22,9,9,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,64,28,22,22,22,22,22,22,22,22,
+    22,9,9,9,28,22,22,22,22,22,22,22,22,64,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,64,64,9,22,9,9,
+    9,9,9,9,9,64,9,9,9,64,9,9,9,9,64,64,64,64,64,64,64,9,9,64,64,64,64,64,64,22,22,64,
+    22,22,9,9,64,64,21,21,21,21,21,21,21,21,21,21,64,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    9,9,9,9,22,22,22,22,22,22,22,22,22,64,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,22,9,9,
+    9,9,9,9,9,64,9,9,9,64,9,9,9,9,22,22,64,64,64,64,22,22,22,9,22,22,22,22,22,22,22,22,
+    22,22,9,9,64,64,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,20,22,22,22,22,22,22,
+    64,9,9,9,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,64,22,64,64,
+    22,22,22,22,22,22,22,64,64,64,9,64,64,64,64,9,9,9,9,9,9,64,9,64,9,9,9,9,9,9,9,9,
+    64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,9,9,22,64,64,64,64,64,64,64,64,64,64,64,
+    64,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,9,39,39,9,9,9,9,9,9,9,64,64,64,64,19,
+    39,39,39,39,39,39,39,9,9,9,9,9,9,9,9,22,21,21,21,21,21,21,21,21,21,21,27,27,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,39,39,64,39,64,39,39,39,39,39,64,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,64,39,64,39,39,39,39,39,39,39,39,39,39,9,39,39,9,9,9,9,9,9,9,9,9,39,64,64,
+    39,39,39,39,39,64,39,64,9,9,9,9,9,9,64,64,21,21,21,21,21,21,21,21,21,21,64,64,39,39,39,39,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,28,28,28,28,22,28,28,8,28,28,27,8,16,16,16,16,16,8,22,16,22,22,22,9,9,22,22,22,22,22,22,
+    21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,27,9,22,9,22,9,11,12,11,12,9,9,
+    22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,27,
+    9,9,9,9,9,27,9,9,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,64,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,27,27,
+    22,22,22,22,22,22,9,22,22,22,22,22,22,64,22,22,28,28,27,28,22,22,22,22,22,8,8,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,39,
+    21,21,21,21,21,21,21,21,21,21,27,27,22,22,22,22,39,39,39,39,39,39,9,9,9,9,39,39,39,39,9,9,
+    9,39,9,9,9,39,39,9,9,9,9,9,9,9,39,39,39,9,9,9,9,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,9,9,9,9,9,9,9,9,9,9,9,9,39,9,21,21,21,21,21,21,21,21,21,21,9,9,9,9,39,39,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,64,22,64,64,64,64,64,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+    100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+    100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,
+    37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+    37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+    37,37,37,37,37,37,37,37,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+    38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+    38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,64,64,22,22,22,22,22,22,22,64,22,64,22,22,22,22,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,64,64,22,22,22,22,22,22,22,64,
+    22,64,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,64,64,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,9,9,9,
+    22,27,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,64,64,
+    27,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    27,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,12,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,27,27,27,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,64,64,64,64,64,64,64,64,64,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,27,27,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,64,9,9,64,64,64,64,64,64,64,64,64,64,64,64,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,27,27,15,39,27,22,27,19,39,9,64,64,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,
+    22,22,16,16,27,27,28,22,16,16,22,9,9,9,8,9,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,
+    22,22,22,22,22,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,9,22,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,
+    22,64,64,64,16,16,21,21,21,21,21,21,21,21,21,21,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,64,64,39,39,39,39,39,64,64,64,64,64,64,64,64,64,64,64,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,39,64,64,64,64,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,39,64,64,64,39,39,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,64,64,22,22,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,9,9,9,9,9,9,9,9,9,9,64,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,9,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,64,64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    9,9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,22,22,22,22,22,22,22,22,64,64,64,21,21,21,21,21,21,21,21,21,21,27,27,22,27,27,27,
+    27,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,22,27,27,64,
+    9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,9,9,9,9,9,9,9,9,9,9,9,9,9,22,22,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,27,27,27,27,27,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,22,22,22,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,27,27,
+    22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,
+    22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,9,9,9,22,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,22,22,22,22,9,22,22,22,22,22,22,9,22,22,9,9,9,22,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,64,64,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,64,22,64,22,64,22,64,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,64,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,64,22,22,22,22,22,22,22,28,22,64,
+    27,27,27,27,27,27,27,8,27,27,27,6,9,10,9,9,27,8,27,27,29,41,41,22,14,14,11,14,14,14,11,14,
+    41,41,22,22,25,25,25,27,1,1,9,9,9,9,9,8,20,20,20,20,20,20,20,20,22,14,14,41,15,15,22,22,
+    22,22,22,22,18,11,12,15,15,15,22,22,22,22,22,22,22,22,22,22,22,22,27,22,27,27,27,27,22,27,27,27,
+    7,22,22,22,22,64,9,9,9,9,9,9,9,9,9,9,22,22,64,64,41,22,22,22,22,22,22,22,22,11,12,41,
+    22,41,41,41,41,22,22,22,22,22,22,22,22,11,12,64,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,
+    19,19,19,19,19,19,19,20,19,83,19,19,19,19,19,19,19,19,19,19,19,19,20,19,19,19,19,20,19,19,20,19,
+    20,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,20,22,41,22,22,22,20,22,22,22,22,22,22,22,22,22,41,22,22,19,22,22,22,22,22,22,22,22,22,
+    22,41,41,22,22,22,22,22,22,22,22,41,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,41,41,22,22,22,22,22,41,22,22,41,22,
+    41,41,41,41,41,41,41,41,41,41,41,41,22,22,22,22,41,41,41,41,41,41,41,41,41,41,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,41,22,22,64,64,64,64,41,41,41,41,41,41,41,41,41,41,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,41,22,41,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    41,22,41,41,22,22,22,41,41,22,22,41,22,22,22,41,22,41,19,19,22,41,22,22,22,22,41,22,22,41,41,41,
+    41,22,22,41,22,41,22,41,41,41,41,41,41,22,41,22,22,22,22,22,41,41,41,41,22,22,22,22,41,41,22,22,
+    22,22,22,22,22,22,22,22,41,22,22,22,41,22,22,22,22,22,41,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    41,41,22,22,41,41,41,41,22,22,41,41,22,22,41,41,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,41,41,22,22,41,41,22,22,22,22,22,22,22,22,22,22,22,22,22,41,22,22,22,41,22,22,22,22,22,22,
+    22,22,22,22,22,41,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,41,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,25,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,11,12,11,12,22,22,22,22,22,22,41,22,22,22,22,22,22,22,88,88,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,75,76,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,86,86,86,86,22,22,22,88,24,24,88,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,22,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,22,22,22,22,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,22,22,22,22,22,22,22,22,22,22,22,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,22,22,41,41,41,41,22,22,22,22,22,22,22,22,22,22,
+    41,41,22,41,41,41,41,41,41,41,22,22,22,22,22,22,22,22,41,41,22,22,41,41,22,22,22,22,41,41,22,22,
+    41,41,22,22,22,22,41,41,41,22,22,41,22,22,41,41,41,41,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,41,41,41,41,22,22,22,22,22,22,22,22,22,41,22,22,22,22,22,22,22,22,22,22,22,22,22,86,86,22,
+    24,24,24,24,22,41,41,22,22,41,22,22,22,22,41,41,22,22,22,22,88,88,41,41,24,22,24,24,24,32,24,24,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,24,24,24,22,22,22,22,
+    41,22,41,22,22,22,22,22,86,86,86,86,86,86,86,86,86,86,86,86,22,22,22,22,22,22,22,22,22,22,22,22,
+    41,41,22,41,41,41,22,41,24,41,41,22,41,41,22,41,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,88,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,86,22,22,22,22,22,22,22,22,22,22,41,41,
+    22,86,22,22,22,22,22,22,22,22,86,86,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,88,88,24,
+    24,24,24,24,88,88,24,24,24,41,41,41,41,24,86,24,24,24,41,24,88,41,41,41,24,24,41,41,24,41,41,24,
+    24,24,22,41,22,22,22,22,41,41,88,41,41,41,41,41,41,24,88,88,24,88,41,24,24,32,88,41,41,88,24,24,
+    24,24,24,24,24,86,22,22,24,24,96,96,32,32,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,86,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,86,22,86,22,22,22,22,86,86,86,22,105,22,22,22,14,14,14,14,14,
+    14,22,16,16,24,22,22,22,11,12,11,12,11,12,11,12,11,12,11,12,11,12,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,22,86,86,86,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,86,22,22,22,22,22,22,22,22,22,22,22,22,22,22,86,
+    22,22,22,22,22,11,12,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,11,12,11,12,11,12,11,12,11,12,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,11,12,11,12,11,12,11,12,11,12,11,12,11,12,11,12,11,12,11,12,11,12,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,12,11,12,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,12,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,86,86,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,86,22,22,22,22,105,41,41,41,41,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,22,22,64,64,64,64,64,16,27,27,27,22,16,27,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,64,22,64,64,64,64,64,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,22,27,64,64,64,64,64,64,64,64,64,64,64,64,64,64,9,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,
+    22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,27,27,27,27,27,27,27,27,22,27,11,27,22,22,14,14,22,22,
+    14,14,11,12,11,12,11,12,11,12,27,27,27,27,16,22,27,27,22,27,27,22,22,22,22,22,29,29,27,27,27,22,
+    27,27,11,27,27,27,27,27,27,27,27,22,27,22,27,27,22,22,22,16,16,11,12,11,12,11,12,11,12,27,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,64,64,64,64,64,64,64,64,64,64,64,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,88,88,88,88,88,88,88,88,88,88,88,88,64,64,64,64,
+    91,76,76,88,88,79,88,88,75,76,75,76,75,76,75,76,75,76,88,88,75,76,75,76,75,76,75,76,79,75,76,76,
+    88,88,88,88,88,88,88,88,88,88,73,73,73,73,73,73,88,88,88,88,88,73,88,88,88,88,88,79,79,88,88,24,
+    64,94,88,94,88,94,88,94,88,94,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,94,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,94,88,94,88,94,88,88,88,88,88,88,94,88,88,88,88,88,88,94,94,64,64,73,73,79,79,79,79,88,
+    79,94,88,94,88,94,88,94,88,94,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,94,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,94,88,94,88,94,88,88,88,88,88,88,94,88,88,88,88,88,88,94,94,88,88,88,88,79,94,79,79,88,
+    64,64,64,64,64,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,64,64,64,64,64,64,64,64,64,64,64,64,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,94,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,41,41,41,41,41,41,41,41,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,79,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,64,64,64,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,27,27,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,27,16,27,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    21,21,21,21,21,21,21,21,21,21,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,22,9,9,9,9,9,9,9,9,9,9,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,22,27,27,27,27,27,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,22,22,64,22,64,22,22,22,22,22,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,9,22,22,22,9,22,22,22,22,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,9,9,9,9,9,22,22,22,22,9,64,64,64,22,22,22,22,22,22,22,22,20,22,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,28,28,16,16,64,64,64,64,64,64,64,64,
+    9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,64,64,64,64,64,64,64,64,27,27,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,22,22,28,22,22,9,
+    21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,9,9,9,9,9,9,9,9,27,27,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,22,
+    100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,64,64,64,
+    9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,22,22,22,22,22,22,27,27,27,22,22,22,22,64,22,21,21,21,21,21,21,21,21,21,21,64,64,64,64,22,22,
+    39,39,39,39,39,9,39,39,39,39,39,39,39,39,39,39,21,21,21,21,21,21,21,21,21,21,39,39,39,39,39,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,
+    22,22,22,9,22,22,22,22,22,22,22,22,9,9,64,64,21,21,21,21,21,21,21,21,21,21,64,64,22,27,27,27,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,9,9,9,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,9,39,9,9,9,39,39,9,9,39,39,39,39,39,9,9,
+    39,9,39,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,39,39,39,39,39,
+    22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,27,27,22,22,22,9,9,64,64,64,64,64,64,64,64,64,
+    64,22,22,22,22,22,22,64,64,22,22,22,22,22,22,64,64,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,9,9,9,9,9,9,9,9,27,9,9,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,99,99,99,99,98,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+    99,99,99,99,64,64,64,64,64,64,64,64,64,64,64,64,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+    37,37,37,37,37,37,37,64,64,64,64,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+    38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,64,64,64,64,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,64,64,64,64,64,23,9,23,
+    23,23,23,23,23,23,23,23,23,22,23,23,23,23,23,23,23,23,23,23,23,23,23,64,23,23,23,23,23,64,23,64,
+    23,23,64,23,23,64,23,23,23,23,23,23,23,23,23,23,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,12,11,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,20,22,22,22,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,82,76,76,82,82,80,80,75,76,89,64,64,64,64,64,64,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,88,88,88,88,88,75,76,75,76,75,76,75,76,75,76,75,
+    76,75,76,75,76,88,88,75,76,88,88,88,88,88,88,88,76,88,76,64,79,79,80,80,88,75,76,75,76,75,76,88,
+    88,88,88,88,88,88,88,64,88,83,84,88,64,64,64,64,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,7,
+    64,80,88,88,83,84,88,88,75,76,88,88,76,88,76,88,88,88,88,88,88,88,88,88,88,88,79,79,88,88,88,80,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,75,88,76,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,75,88,76,88,75,
+    76,76,75,76,76,79,88,94,94,94,94,94,94,94,94,94,94,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,79,79,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,
+    64,64,88,88,88,88,88,88,64,64,88,88,88,88,88,88,64,64,88,88,88,88,88,88,64,64,88,88,88,64,64,64,
+    84,83,88,88,88,83,83,64,86,86,86,86,86,86,86,64,64,64,64,64,64,64,64,64,64,9,9,9,40,41,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,64,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,
+    27,27,27,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,
+    22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,27,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,64,64,64,64,22,22,22,22,22,22,22,22,27,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,64,22,22,22,22,22,22,22,22,22,
+    22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,64,64,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,64,64,64,22,64,64,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,27,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,64,64,64,64,64,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,27,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,22,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,9,9,9,64,9,9,64,64,64,64,64,9,9,9,9,22,22,22,22,64,22,22,22,64,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,9,9,9,64,64,64,64,9,
+    22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,27,27,27,27,27,27,27,27,22,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,9,9,64,64,64,64,22,22,22,22,22,27,27,27,27,27,27,25,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,27,27,27,27,27,27,27,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,22,22,22,22,64,64,64,
+    64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,9,9,9,9,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,64,9,9,27,64,64,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,9,9,9,9,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,
+    9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,27,27,22,22,22,22,22,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,21,21,21,21,21,21,21,21,21,21,9,22,22,9,9,22,64,64,64,64,64,64,64,64,64,9,
+    9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,22,22,22,27,27,
+    27,27,9,64,64,64,64,64,64,64,64,64,64,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,21,21,21,21,21,21,21,21,21,21,
+    27,27,27,27,22,9,9,22,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,22,28,22,64,64,64,64,64,64,64,64,64,
+    9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,22,22,22,22,27,27,22,27,9,9,9,9,22,9,9,21,21,21,21,21,21,21,21,21,21,22,28,22,27,27,27,
+    64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,27,27,22,27,27,22,9,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,64,22,64,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,
+    22,22,22,22,22,22,22,22,22,27,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,
+    9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    9,9,9,9,64,22,22,22,22,22,22,22,22,64,64,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,64,22,22,22,22,22,64,9,9,22,9,9,
+    9,9,9,9,9,64,64,9,9,64,64,9,9,9,64,64,22,64,64,64,64,64,64,9,64,64,64,64,64,22,22,22,
+    22,22,9,9,64,64,9,9,9,9,9,9,9,64,64,64,9,9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,22,22,22,22,27,27,27,27,22,21,21,21,21,21,21,21,21,21,21,27,27,64,22,9,22,
+    22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,22,22,22,22,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,64,64,9,9,9,9,9,9,9,9,
+    9,28,27,27,16,16,22,22,22,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,22,22,22,22,9,9,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,27,27,22,22,64,64,64,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    28,28,28,28,28,28,28,28,28,28,28,28,28,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,22,22,64,64,64,64,64,64,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,64,64,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,21,21,21,21,21,21,21,21,21,21,39,39,27,27,27,39,
+    39,39,39,39,39,39,39,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,22,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,22,
+    22,22,22,22,22,22,22,64,64,22,64,64,22,22,22,22,22,22,22,22,64,22,22,64,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,64,9,9,64,64,9,9,9,9,22,
+    9,22,9,9,27,27,27,64,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,64,64,9,9,9,9,9,9,
+    9,22,28,22,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,9,9,9,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,22,9,9,9,9,28,
+    22,27,27,27,27,28,22,9,64,64,64,64,64,64,64,64,22,9,9,9,9,9,9,9,9,9,9,9,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,27,27,27,22,28,28,
+    28,27,27,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,9,64,9,9,9,9,9,9,9,9,
+    22,27,27,27,27,27,64,64,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,28,16,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,64,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,64,64,64,9,64,9,9,64,9,
+    9,9,9,9,9,9,22,9,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    22,22,22,22,22,22,64,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,64,9,9,64,9,9,9,9,9,22,64,64,64,64,64,64,64,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,22,22,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,20,20,20,
+    20,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,27,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,27,27,27,27,27,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,11,11,12,12,12,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,12,22,22,22,11,12,11,12,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,12,12,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,8,8,8,8,8,8,8,11,12,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,11,12,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,27,27,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,9,9,9,9,9,27,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,27,27,27,22,22,22,22,22,22,
+    22,22,22,22,27,22,64,64,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,22,22,22,22,22,
+    22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,27,27,22,22,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,9,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    79,79,79,79,72,64,64,64,64,64,64,64,64,64,64,64,73,73,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,64,64,64,64,64,64,64,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,
+    86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,86,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    88,88,88,88,88,88,88,88,88,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,86,86,86,86,64,86,86,86,86,86,86,86,64,86,86,64,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,94,94,94,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,94,94,94,94,64,64,64,64,64,64,64,64,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,
+    22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,64,64,22,9,9,27,
+    9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,9,9,9,9,9,22,22,22,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,22,22,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,9,9,9,9,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,9,9,9,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,
+    64,64,22,64,64,22,22,64,64,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,64,22,64,22,22,22,
+    22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,64,22,22,22,22,64,64,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,64,
+    22,22,22,22,22,64,22,64,64,64,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,64,64,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,22,22,22,22,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,22,22,22,22,22,22,22,22,9,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,9,22,22,27,27,27,27,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,9,9,9,9,9,
+    64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    9,9,9,9,9,9,9,64,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,9,9,9,9,9,
+    9,9,64,9,9,64,9,9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,9,9,9,9,9,9,9,22,22,22,22,22,22,22,64,64,
+    21,21,21,21,21,21,21,21,21,21,64,64,64,64,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,9,9,9,9,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,19,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,64,22,22,22,22,64,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,64,64,22,22,22,22,22,22,22,22,22,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,9,9,9,9,9,9,9,22,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,11,11,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,20,22,22,22,20,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    64,22,22,64,22,64,64,22,64,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,64,22,64,22,64,64,64,64,
+    64,64,22,64,64,64,64,22,64,22,64,22,64,22,22,22,64,22,22,64,22,64,64,22,64,22,64,22,64,22,64,22,
+    64,22,22,64,22,64,64,22,22,22,22,64,22,22,22,22,22,22,22,64,22,22,22,22,64,22,22,22,22,64,22,64,
+    22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,
+    64,22,22,22,64,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    24,24,24,24,88,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,216,216,216,216,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,216,216,216,216,216,216,216,216,216,216,216,216,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,216,216,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    216,24,24,24,24,24,24,24,24,24,24,24,24,24,24,88,216,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,216,216,216,216,216,216,216,216,216,216,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,24,24,24,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,22,22,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,22,22,22,24,24,24,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,41,105,41,41,105,105,105,105,105,105,105,105,105,105,41,41,41,41,41,
+    41,41,41,41,41,41,41,41,41,41,41,41,41,24,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+    88,88,88,216,216,216,216,216,216,216,216,216,216,216,216,216,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,216,216,216,216,
+    88,88,88,88,88,88,88,88,88,216,216,216,216,216,216,216,88,88,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    88,88,88,88,88,88,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,24,24,24,24,24,24,24,24,24,24,24,24,88,88,88,88,88,88,88,88,88,24,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,24,88,88,
+    88,88,88,88,88,96,88,88,88,88,88,88,88,88,88,88,88,88,88,88,24,24,24,24,24,24,24,24,22,22,24,24,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,86,86,88,88,88,88,88,86,88,88,88,
+    88,88,96,96,96,88,88,96,88,88,96,32,32,24,24,88,88,88,88,88,24,24,24,24,24,24,24,24,24,24,24,24,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,24,24,24,88,24,24,24,88,88,88,97,97,97,97,97,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,24,
+    88,24,96,96,88,88,96,96,96,96,96,96,96,96,96,96,96,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,88,88,88,96,88,88,88,
+    88,96,96,96,88,96,96,96,88,88,88,88,88,88,88,96,88,96,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    86,88,86,88,86,88,88,88,88,88,96,88,88,88,88,86,88,86,86,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,24,24,88,
+    86,86,86,86,86,86,86,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,86,86,86,86,86,86,86,86,86,
+    86,86,86,86,86,88,88,88,88,88,88,88,88,88,88,88,88,88,86,86,86,86,86,86,86,86,86,86,86,86,22,22,
+    22,22,22,22,22,22,22,22,22,22,24,88,88,88,88,24,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,24,24,24,24,24,24,24,24,24,24,24,24,32,32,24,24,24,24,96,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,32,24,24,24,24,96,96,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,88,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,22,22,22,22,22,22,22,22,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,22,22,22,22,22,22,24,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,96,96,96,88,88,88,96,96,96,96,96,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,14,14,14,15,15,15,22,22,22,22,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,96,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,96,96,96,88,88,88,88,88,88,88,88,88,
+    96,88,88,88,88,88,24,24,24,24,24,24,96,24,24,24,88,88,88,24,24,88,88,88,216,216,216,216,216,88,88,88,
+    24,24,24,24,24,24,24,24,24,24,24,88,88,216,216,216,24,24,24,24,88,88,88,88,88,88,88,88,88,216,216,216,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,216,216,216,216,216,216,216,216,216,216,216,216,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,24,24,24,24,216,216,216,216,216,216,216,
+    88,88,88,88,88,88,88,88,88,88,88,88,216,216,216,216,88,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    22,22,22,22,22,22,22,22,22,22,22,22,216,216,216,216,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,216,216,216,216,216,216,216,216,22,22,22,22,22,22,22,22,22,22,216,216,216,216,216,216,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,216,216,216,216,216,216,216,216,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,216,216,24,24,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    22,22,22,22,22,22,22,22,22,22,22,22,96,88,88,96,88,88,88,88,88,88,88,88,96,96,96,96,96,96,96,96,
+    88,88,88,88,88,88,96,88,88,88,88,88,88,88,88,88,96,96,96,96,96,96,96,96,96,96,88,24,96,96,96,88,
+    88,88,88,88,88,88,24,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,96,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,96,96,88,96,96,88,96,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,96,96,96,88,96,96,96,96,96,96,96,96,96,96,96,96,96,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,216,216,216,216,216,216,216,216,216,216,216,216,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,216,216,88,88,88,88,88,216,216,216,88,88,88,88,88,216,216,216,
+    88,88,88,88,88,88,88,216,216,216,216,216,216,216,216,216,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,216,216,216,88,88,88,88,88,88,88,88,88,88,88,216,216,216,216,216,
+    88,88,88,96,96,96,216,216,216,216,216,216,216,216,216,216,88,88,88,88,88,88,88,88,88,88,216,216,216,216,216,216,
+    88,88,88,88,88,88,88,88,216,216,216,216,216,216,216,216,96,96,96,96,96,96,96,216,216,216,216,216,216,216,216,216,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,64,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+    22,22,22,22,22,22,22,22,22,22,22,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,21,21,21,21,21,21,21,21,21,21,64,64,64,64,64,64,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,
+    216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,216,64,64,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,
+    88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,88,64,64,
+    64,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+    9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,64,
+};
+
+}
@@ -0,0 +1,228 @@
+#include "ofxMixedFontSystemFallback.hpp"
+#include "ofxFT2Font.hpp"
+
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include "ofConstants.h"
+#include "ofFileUtils.h"
+#include "ofLog.h"
+#include "ofPath.h"
+#include "ofUtils.h"
+
+#ifdef TARGET_LINUX
+#include <fontconfig/fontconfig.h>
+#endif
+
+namespace ofxMixedFontUtil {
+
+const std::uint32_t ofxSystemFontResolver::BLOCK_SHIFT;
+
+#ifdef TARGET_LINUX
+static std::once_flag fontconfig_init_flag;
+
+static bool queryFontconfig(const char32_t &code_point, std::string &file_path, int &face_index)
+{
+    std::call_once(fontconfig_init_flag, []() {
+        if (!FcInit()) {
+            ofLogError("ofxMixedFont") << "queryFontconfig(): couldn't initialize fontconfig";
+        }
+    });
+    
+    FcPattern *pattern = FcPatternCreate();
+    FcCharSet *char_set = FcCharSetCreate();
+    FcCharSetAddChar(char_set, code_point);
+    FcPatternAddCharSet(pattern, FC_CHARSET, char_set);
+    FcPatternAddBool(pattern, FC_SCALABLE, FcTrue);
+    FcConfigSubstitute(nullptr, pattern, FcMatchPattern);
+    FcDefaultSubstitute(pattern);
+    
+    // Note: FcFontMatch() returns the closest font even if it doesn't have the code point
+    bool is_found = false;
+    FcResult match_result;
+    FcPattern *match = FcFontMatch(nullptr, pattern, &match_result);
+    if (match) {
+        FcChar8 *file = nullptr;
+        FcCharSet *match_char_set = nullptr;
+        int index = 0;
+        if (FcPatternGetString(match, FC_FILE, 0, &file) == FcResultMatch
+            && FcPatternGetCharSet(match, FC_CHARSET, 0, &match_char_set) == FcResultMatch
+            && FcCharSetHasChar(match_char_set, code_point)) {
+            FcPatternGetInteger(match, FC_INDEX, 0, &index);
+            file_path = reinterpret_cast<const char *>(file);
+            face_index = index & 0xFFFF; // Note: upper bits are the named instance of a variable font
+            is_found = true;
+        }
+        FcPatternDestroy(match);
+    }
+    FcCharSetDestroy(char_set);
+    FcPatternDestroy(pattern);
+    
+    return is_found;
+}
+#else
+static bool queryFontconfig(const char32_t &, std::string &, int &)
+{
+    return false;
+}
+#endif
+
+static bool resultFileExists(const std::string &file_path)
+{
+    return file_path.empty() || ofFile(file_path, ofFile::Reference).exists();
+}
+
+ofxSystemFontResolver::ofxSystemFontResolver(const std::string &cache_file_name)
+: cache_file_path_(cache_file_name.empty() ? "" : ofToDataPath(cache_file_name, true))
+{
+    loadCache();
+}
+
+bool ofxSystemFontResolver::resolve(const char32_t &code_point, std::string &file_path, int &face_index)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    auto found_code_point = code_point_results_.find(code_point);
+    if (found_code_point != code_point_results_.end() && resultFileExists(found_code_point->second.file_path)) {
+        file_path = found_code_point->second.file_path;
+        face_index = found_code_point->second.face_index;
+        return !file_path.empty();
+    }
+    
+    const std::uint32_t block = code_point >> BLOCK_SHIFT;
+    auto found = block_results_.find(block);
+    if (found != block_results_.end() && resultFileExists(found->second.file_path)) {
+        file_path = found->second.file_path;
+        face_index = found->second.face_index;
+        return true;
+    }
+    
+    // Note: A miss is kept only for the code point, since another code point of the block may be found
+    Result result = { "", 0 };
+    if (queryFontconfig(code_point, result.file_path, result.face_index)) {
+        block_results_[block] = result;
+        appendCache(false, block, result);
+    }
+    else {
+        appendCache(true, code_point, result);
+    }
+    code_point_results_[code_point] = result;
+    file_path = result.file_path;
+    face_index = result.face_index;
+    
+    return !file_path.empty();
+}
+
+bool ofxSystemFontResolver::resolveCodePoint(const char32_t &code_point, std::string &file_path, int &face_index)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    // Note: resolve() has also kept the answer of fontconfig here, if it has asked fontconfig for the code point
+    auto found = code_point_results_.find(code_point);
+    if (found == code_point_results_.end() || !resultFileExists(found->second.file_path)) {
+        Result result = { "", 0 };
+        queryFontconfig(code_point, result.file_path, result.face_index);
+        code_point_results_[code_point] = result;
+        appendCache(true, code_point, result);
+        found = code_point_results_.find(code_point);
+    }
+    file_path = found->second.file_path;
+    face_index = found->second.face_index;
+    
+    return !file_path.empty();
+}
+
+int ofxSystemFontResolver::loadCache()
+{
+    if (cache_file_path_.empty()) return 0;
+    
+    std::ifstream stream(cache_file_path_);
+    if (!stream) return -1;
+    
+    // Note: one line per block: "<block in hex> <face index> <file path>", or per code point: "U+<code point in hex> <face index> <file path>"
+    //       (the path is empty if no font has the code point). A later line overrides an earlier one.
+    std::string line;
+    while (std::getline(stream, line)) {
+        const bool is_code_point = (line.compare(0, 2, "U+") == 0);
+        std::istringstream line_stream(is_code_point ? line.substr(2) : line);
+        std::uint32_t key = 0;
+        Result result = { "", 0 };
+        if (!(line_stream >> std::hex >> key >> std::dec >> result.face_index)) {
+            continue;
+        }
+        line_stream.get();
+        std::getline(line_stream, result.file_path);
+        if (is_code_point) {
+            code_point_results_[key] = result;
+        }
+        else if (!result.file_path.empty()) { // Note: blocks that no font had, written by older versions
+            block_results_[key] = result;
+        }
+    }
+    
+    return 0;
+}
+
+int ofxSystemFontResolver::appendCache(const bool &is_code_point, const std::uint32_t &key, const Result &result) const
+{
+    if (cache_file_path_.empty()) return 0;
+    
+    std::ofstream stream(cache_file_path_, std::ios::app);
+    if (!stream) {
+        ofLogError("ofxMixedFont") << "appendCache(): couldn't open \"" << cache_file_path_ << "\"";
+        return -1;
+    }
+    stream << (is_code_point ? "U+" : "") << std::hex << key << std::dec << " " << result.face_index << " " << result.file_path << "\n";
+    
+    return 0;
+}
+
+ofxFallbackFontProvider makeSystemFallbackProvider(const float &font_size_pt, const std::string &cache_file_name)
+{
+    // Note: Blocks covered by the same font get the same instance, so that ofxMixedFont adds it only once
+    std::shared_ptr<ofxSystemFontResolver> resolver = std::make_shared<ofxSystemFontResolver>(cache_file_name);
+    std::shared_ptr<std::map<std::pair<std::string, int>, ofxBaseFontPtr>> fonts = std::make_shared<std::map<std::pair<std::string, int>, ofxBaseFontPtr>>();
+    
+    auto get_font = [fonts, font_size_pt](const std::string &file_path, const int &face_index) -> ofxBaseFontPtr {
+        const std::pair<std::string, int> key = std::make_pair(file_path, face_index);
+        auto found = fonts->find(key);
+        if (found != fonts->end()) {
+            return found->second;
+        }
+        
+        std::shared_ptr<ofxFT2Font> font = std::make_shared<ofxFT2Font>(file_path, font_size_pt, face_index);
+        if (!font->isReady()) {
+            font.reset();
+        }
+        (*fonts)[key] = font;
+        
+        return font;
+    };
+    
+    return [resolver, get_font](const char32_t &code_point) -> ofxBaseFontPtr {
+        std::string file_path;
+        int face_index = 0;
+        if (!resolver->resolve(code_point, file_path, face_index)) {
+            return ofxBaseFontPtr();
+        }
+        
+        ofxBaseFontPtr font = get_font(file_path, face_index);
+        int length = 0;
+        if (font) {
+            font->makeGlyphData(std::u32string(1, code_point), 0, length);
+        }
+        if (length > 0) {
+            return font;
+        }
+        
+        // Note: The font of the block doesn't have the code point
+        if (!resolver->resolveCodePoint(code_point, file_path, face_index)) {
+            return ofxBaseFontPtr();
+        }
+        
+        return get_font(file_path, face_index);
+    };
+}
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "ofxMixedFont.hpp"
+
+namespace ofxMixedFontUtil {
+
+// Note: ofxSystemFontResolver finds an installed font for a code point by fontconfig (Linux only, it finds nothing on other platforms).
+//       resolve() answers the font found first in a block of (1 << BLOCK_SHIFT) code points for the whole block, and appends it to the cache file
+//       if one is given, so that later runs skip fontconfig. Use resolveCodePoint() when that font doesn't have a code point.
+//       Answers for single code points (including code points that no font has) are appended to the cache file too.
+//       Delete the cache file after installing or uninstalling fonts.
+class ofxSystemFontResolver
+{
+public:
+    static const std::uint32_t BLOCK_SHIFT = 7; // Note: 128 code points per block
+    
+    explicit ofxSystemFontResolver(const std::string &cache_file_name = "");
+    
+    bool resolve(const char32_t &code_point, std::string &file_path, int &face_index);
+    bool resolveCodePoint(const char32_t &code_point, std::string &file_path, int &face_index);
+
+private:
+    typedef struct {
+        std::string file_path; // Note: empty if no font has the code point
+        int face_index;
+    } Result;
+    
+    int loadCache();
+    int appendCache(const bool &is_code_point, const std::uint32_t &key, const Result &result) const; // Note: key is a block or a code point
+    
+    std::string cache_file_path_;
+    std::unordered_map<std::uint32_t, Result> block_results_;
+    std::unordered_map<char32_t, Result> code_point_results_;
+    std::mutex mutex_;
+
+};
+
+// Note: Makes an ofxFT2Font of font_size_pt for each system font that ofxSystemFontResolver finds. (ex. mixedFont->setFallbackProvider(makeSystemFallbackProvider(64, "fallback.cache")))
+//       When the font of a block doesn't have a code point, the font for the code point itself is returned.
+ofxFallbackFontProvider makeSystemFallbackProvider(const float &font_size_pt, const std::string &cache_file_name = "");
+
+}
@@ -1,10 +1,14 @@
 #include "ofxMixedFontUtil.hpp"
 
+#include "ofxMixedFontCompositor.hpp"
+
 #include "ofTexture.h"
 #include "ofPath.h"
+#include "ofPixels.h"
 
 #include <locale>
 #include <codecvt>
+#include <algorithm>
 
 namespace ofxMixedFontUtil {
 
@@ -40,30 +44,55 @@ const std::u32string convertStringToU32string(const std::string &src_string)
 #endif
 }
 
-void defaultCompFunc(const std::shared_ptr<ofxBaseFont> &font, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list)
+static bool IsTrailingBlank(const ofxGlyphData &glyph)
 {
-    ofPoint pos = coord;
-    for (auto &glyph : glyph_list) {
-        glyph.coord = pos;
-        
-        if (glyph.props.code_point == U"\n") {
-            pos.x = coord.x;
-            pos.y += font->getFontProps().line_height;
-        }
-        else if (glyph.props.code_point == U" ") {
-            pos.x += font->getFontProps().x_ppem / 2.f;
-        }
-        else if (glyph.props.code_point == U"　") {
-            pos.x += font->getFontProps().x_ppem;
-        }
-        else {
-            pos.x += glyph.props.advance;
+    if (glyph.props.code_point.empty()) return false;
+    
+    const ofxBidiClass bidi_class = getBidiClass(glyph.props.code_point[0]);
+    return (bidi_class == BIDI_WS || bidi_class == BIDI_S || bidi_class == BIDI_B);
+}
+
+void reorderGlyphsByBidiLevels(const ofxFontProps &font_props, std::vector<ofxGlyphData> &glyph_list, const int &begin, const int &end)
+{
+    bool has_rtl_glyph = false;
+    for (int i = begin; i < end; ++i) {
+        if (glyph_list[i].bidi_level > 0) {
+            has_rtl_glyph = true;
+            break;
         }
     }
+    if (!has_rtl_glyph) return;
+    
+    const int count = end - begin;
+    std::vector<unsigned char> levels(count);
+    for (int i = 0; i < count; ++i) {
+        levels[i] = glyph_list[begin + i].bidi_level;
+    }
+    
+    // Note: L1 for the end of a line. Trailing white spaces get the lowest level of the line.
+    const unsigned char line_level = *std::min_element(levels.begin(), levels.end());
+    for (int i = count - 1; i >= 0 && IsTrailingBlank(glyph_list[begin + i]); --i) {
+        levels[i] = line_level;
+    }
+    
+    std::vector<int> order;
+    getVisualOrder(levels.data(), count, order);
+    
+    float x = glyph_list[begin].coord.x;
+    for (int i = 0; i < count; ++i) {
+        ofxGlyphData &glyph = glyph_list[begin + order[i]];
+        glyph.coord.x = x;
+        x += getGlyphAdvance(font_props, glyph.props);
+    }
+}
+
+void defaultCompFunc(const std::shared_ptr<ofxBaseFont> &font, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list)
+{
+    ofxDefaultCompPolicy()(font, coord, glyph_list);
 }
 
 ofxBaseFont::ofxBaseFont()
-: font_props_(), is_ready_(false), texture_is_enabled_(false), path_is_enabled_(false)
+: font_props_(), is_ready_(false), texture_is_enabled_(false), path_is_enabled_(false), typeset_cache_(DEFAULT_TYPESET_CACHE_CAPACITY), base_direction_(BIDI_DIRECTION_AUTO)
 {
     
 }
@@ -88,37 +117,107 @@ ofxFontProps ofxBaseFont::getFontProps() const
     return font_props_;
 }
 
+void ofxBaseFont::setTypesetCacheCapacity(const std::size_t &capacity)
+{
+    typeset_cache_.setCapacity(capacity);
+}
+
+void ofxBaseFont::clearTypesetCache()
+{
+    typeset_cache_.clear();
+}
+
+ofxCacheStats ofxBaseFont::getTypesetCacheStats() const
+{
+    return typeset_cache_.getStats();
+}
+
+std::size_t ofxBaseFont::getTypesetConfigHash() const
+{
+    return combineHash(std::hash<float>()(font_props_.font_size_pt), base_direction_);
+}
+
+void ofxBaseFont::setBaseDirection(const ofxBidiDirection &direction)
+{
+    base_direction_ = direction;
+}
+
+ofxBidiDirection ofxBaseFont::getBaseDirection() const
+{
+    return base_direction_;
+}
+
+int ofxBaseFont::appendGlyphData(const std::u32string &utf32_string, const int &index, std::vector<ofxGlyphData> &glyph_list)
+{
+    int length = 0;
+    glyph_list.push_back(makeGlyphData(utf32_string, index, length));
+    glyph_list.back().string_index = index;
+    
+    return length;
+}
+
 float ofxBaseFont::getDPI() const
 {
     return ofxMixedFontUtil::DPI;
 }
 
+void ofxBaseFont::setClipRectangle(const ofRectangle &clip_rectangle)
+{
+    clip_rectangle_ = std::make_shared<ofRectangle>(clip_rectangle);
+}
+
+void ofxBaseFont::clearClipRectangle()
+{
+    clip_rectangle_.reset();
+}
+
+bool ofxBaseFont::hasClipRectangle() const
+{
+    return static_cast<bool>(clip_rectangle_);
+}
+
+bool ofxBaseFont::glyphIsVisible(const ofxGlyphData &glyph) const
+{
+    if (!clip_rectangle_) return true;
+    
+    float left = glyph.coord.x + glyph.props.bearing_x;
+    float top = glyph.coord.y - glyph.props.bearing_y;
+    float right = left + glyph.props.width;
+    float bottom = top + glyph.props.height;
+    
+    return (right >= clip_rectangle_->getLeft() && left <= clip_rectangle_->getRight()
+            && bottom >= clip_rectangle_->getTop() && top <= clip_rectangle_->getBottom());
+}
+
 // utf32
 void ofxBaseFont::drawStringWithTexture(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func)
 {
     if (!isReady()) return;
     
-    std::vector<ofxGlyphData> glyph_list = typesetString(utf32_string, coord, func);
-    drawGlyphsWithTexture(glyph_list);
+    ScopedTypesetBuffer buffer(typeset_buffer_);
+    typesetString(utf32_string, coord, buffer.glyphs, func);
+    drawGlyphsWithTexture(buffer.glyphs);
 }
 
 void ofxBaseFont::drawStringWithPath(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func)
 {
     if (!isReady()) return;
     
-    std::vector<ofxGlyphData> glyph_list = typesetString(utf32_string, coord, func);
-    drawGlyphsWithPath(glyph_list);
+    ScopedTypesetBuffer buffer(typeset_buffer_);
+    typesetString(utf32_string, coord, buffer.glyphs, func);
+    drawGlyphsWithPath(buffer.glyphs);
 }
 
 ofRectangle ofxBaseFont::getStringBoundingBox(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func)
 {
     if (!isReady()) return ofRectangle();
     
-    std::vector<ofxGlyphData> glyph_list = typesetString(utf32_string, coord, func);
+    ScopedTypesetBuffer buffer(typeset_buffer_);
+    typesetString(utf32_string, coord, buffer.glyphs, func);
     ofPoint min(coord.x, coord.y);
     ofPoint max(coord.x, coord.y);
     
-    for (auto &glyph : glyph_list) {
+    for (auto &glyph : buffer.glyphs) {
         if (glyph.coord.x + glyph.props.bearing_x < min.x) { min.x = glyph.coord.x + glyph.props.bearing_x; }
         if (glyph.coord.y - glyph.props.bearing_y < min.y) { min.y = glyph.coord.y - glyph.props.bearing_y; }
         if (glyph.coord.x + glyph.props.bearing_x + glyph.props.width > max.x) { max.x = glyph.coord.x + glyph.props.bearing_x + glyph.props.width; }
@@ -133,15 +232,173 @@ std::vector<ofRectangle> ofxBaseFont::getGlyphBoundingBoxes(const std::u32string
     std::vector<ofRectangle> bboxes;
     if (!isReady()) return bboxes;
     
-    std::vector<ofxGlyphData> glyph_list = typesetString(utf32_string, coord, func);
+    ScopedTypesetBuffer buffer(typeset_buffer_);
+    typesetString(utf32_string, coord, buffer.glyphs, func);
+    bboxes.reserve(buffer.glyphs.size());
     
-    for (auto &glyph : glyph_list) {
+    for (auto &glyph : buffer.glyphs) {
         bboxes.push_back(ofRectangle(glyph.coord.x + glyph.props.bearing_x, glyph.coord.y - glyph.props.bearing_y, glyph.props.width, glyph.props.height));
     }
     
     return bboxes;
 }
 
+float ofxBaseFont::getStringAdvance(const std::u32string &utf32_string)
+{
+    typesetGlyphs(utf32_string, typeset_buffer_);
+    float advance = 0.f;
+    for (auto &glyph : typeset_buffer_) {
+        advance += getGlyphAdvance(font_props_, glyph.props);
+    }
+    
+    return advance;
+}
+
+int ofxBaseFont::findFitLength(const std::u32string &utf32_string, const float &max_width, const float &ellipsis_width)
+{
+    typesetGlyphs(utf32_string, typeset_buffer_);
+    
+    // Note: A cut after a glyph keeps the characters before the next glyph, so that a cluster of several glyphs is kept or cut as a whole
+    fit_advance_sums_.assign(1, 0.f);
+    fit_string_offsets_.assign(1, 0);
+    float advance_sum = 0.f;
+    for (int i = 0; i < typeset_buffer_.size(); ++i) {
+        advance_sum += getGlyphAdvance(font_props_, typeset_buffer_[i].props);
+        const int string_offset = (i + 1 < typeset_buffer_.size()) ? typeset_buffer_[i + 1].string_index : utf32_string.length();
+        fit_advance_sums_.push_back(advance_sum);
+        fit_string_offsets_.push_back(std::max(fit_string_offsets_.back(), string_offset));
+    }
+    if (advance_sum <= max_width) {
+        return utf32_string.length();
+    }
+    
+    auto found = std::upper_bound(fit_advance_sums_.begin(), fit_advance_sums_.end(), max_width - ellipsis_width);
+    if (found == fit_advance_sums_.begin()) {
+        return -1; // Note: Even the ellipsis doesn't fit
+    }
+    int length = fit_string_offsets_[found - fit_advance_sums_.begin() - 1];
+    while (length > 0 && (utf32_string[length - 1] == U' ' || utf32_string[length - 1] == U'\u3000')) {
+        --length;
+    }
+    
+    return length;
+}
+
+std::u32string ofxBaseFont::fitString(const std::u32string &utf32_string, const float &max_width, const std::u32string &ellipsis)
+{
+    if (!isReady()) return utf32_string;
+    
+    const float ellipsis_width = getStringAdvance(ellipsis);
+    const int length = findFitLength(utf32_string, max_width, ellipsis_width);
+    if (length < 0) {
+        return std::u32string();
+    }
+    
+    return (length == utf32_string.length()) ? utf32_string : utf32_string.substr(0, length) + ellipsis;
+}
+
+void ofxBaseFont::fitStrings(const std::vector<std::u32string> &utf32_strings, const float &max_width, std::vector<std::u32string> &fitted_strings, const std::u32string &ellipsis)
+{
+    fitted_strings.resize(utf32_strings.size());
+    if (!isReady()) {
+        std::copy(utf32_strings.begin(), utf32_strings.end(), fitted_strings.begin());
+        return;
+    }
+    
+    // Note: The ellipsis is measured once, and the fitted strings reuse their capacity
+    const float ellipsis_width = getStringAdvance(ellipsis);
+    for (int i = 0; i < utf32_strings.size(); ++i) {
+        const int length = findFitLength(utf32_strings[i], max_width, ellipsis_width);
+        if (length < 0) {
+            fitted_strings[i].clear();
+        }
+        else if (length == utf32_strings[i].length()) {
+            fitted_strings[i].assign(utf32_strings[i]);
+        }
+        else {
+            fitted_strings[i].assign(utf32_strings[i], 0, length);
+            fitted_strings[i].append(ellipsis);
+        }
+    }
+}
+
+ofPixels ofxBaseFont::getStringAsPixels(const std::u32string &utf32_string, const ofxCompFunc &func)
+{
+    return getStringAsPixels(utf32_string, ofColor(255, 255, 255), func);
+}
+
+ofPixels ofxBaseFont::getStringAsPixels(const std::u32string &utf32_string, const ofColor &color, const ofxCompFunc &func)
+{
+    ofPixels pixels;
+    if (!isReady()) return pixels;
+    
+    std::vector<ofxGlyphData> glyph_list = typesetString(utf32_string, ofPoint(0, 0), func);
+    ofPoint min(0, 0);
+    ofPoint max(0, 0);
+    for (auto &glyph : glyph_list) {
+        if (glyph.props.width == 0 || glyph.props.height == 0) {
+            continue;
+        }
+        if (glyph.coord.x + glyph.props.bearing_x < min.x) { min.x = glyph.coord.x + glyph.props.bearing_x; }
+        if (glyph.coord.y - glyph.props.bearing_y < min.y) { min.y = glyph.coord.y - glyph.props.bearing_y; }
+        if (glyph.coord.x + glyph.props.bearing_x + glyph.props.width > max.x) { max.x = glyph.coord.x + glyph.props.bearing_x + glyph.props.width; }
+        if (glyph.coord.y - glyph.props.bearing_y + glyph.props.height > max.y) { max.y = glyph.coord.y - glyph.props.bearing_y + glyph.props.height; }
+    }
+    
+    int width = std::ceil(max.x - std::floor(min.x));
+    int height = std::ceil(max.y - std::floor(min.y));
+    if (width <= 0 || height <= 0) {
+        return pixels;
+    }
+    
+    pixels.allocate(width, height, 4);
+    pixels.set(0);
+    ofPoint offset(-std::floor(min.x), -std::floor(min.y));
+    
+    if (width * height < PARALLEL_COMPOSITION_MIN_PIXELS) {
+        drawGlyphsIntoPixels(glyph_list, pixels, offset, color);
+        unpremultiplyRGBA(pixels.getData(), pixels.getWidth() * pixels.getHeight());
+        return pixels;
+    }
+    
+    // Note: Glyphs are binned by tile, and each tile is composed by one thread without locks
+    loadGlyphBitmaps(glyph_list);
+    
+    const int tile_cols = (width + COMPOSITION_TILE_SIZE - 1) / COMPOSITION_TILE_SIZE;
+    const int tile_rows = (height + COMPOSITION_TILE_SIZE - 1) / COMPOSITION_TILE_SIZE;
+    std::vector<std::vector<ofxGlyphData>> tile_glyphs(tile_cols * tile_rows);
+    for (auto &glyph : glyph_list) {
+        if (glyph.props.width == 0 || glyph.props.height == 0) {
+            continue;
+        }
+        float left = glyph.coord.x + offset.x + glyph.props.bearing_x;
+        float top = glyph.coord.y + offset.y - glyph.props.bearing_y;
+        int begin_col = std::max(0, static_cast<int>(left) / COMPOSITION_TILE_SIZE);
+        int end_col = std::min(tile_cols - 1, static_cast<int>(left + glyph.props.width + 1) / COMPOSITION_TILE_SIZE);
+        int begin_row = std::max(0, static_cast<int>(top) / COMPOSITION_TILE_SIZE);
+        int end_row = std::min(tile_rows - 1, static_cast<int>(top + glyph.props.height + 1) / COMPOSITION_TILE_SIZE);
+        for (int row = begin_row; row <= end_row; ++row) {
+            for (int col = begin_col; col <= end_col; ++col) {
+                tile_glyphs[row * tile_cols + col].push_back(glyph);
+            }
+        }
+    }
+    
+    parallelFor(tile_cols * tile_rows, [&](const int &tile_index) {
+        int tile_x = (tile_index % tile_cols) * COMPOSITION_TILE_SIZE;
+        int tile_y = (tile_index / tile_cols) * COMPOSITION_TILE_SIZE;
+        int tile_width = std::min(COMPOSITION_TILE_SIZE, width - tile_x);
+        int tile_height = std::min(COMPOSITION_TILE_SIZE, height - tile_y);
+        
+        drawLoadedGlyphsIntoPixels(tile_glyphs[tile_index], pixels, offset, color, ofRectangle(tile_x, tile_y, tile_width, tile_height));
+        for (int y = tile_y; y < tile_y + tile_height; ++y) {
+            unpremultiplyRGBA(pixels.getData() + (y * width + tile_x) * 4, tile_width);
+        }
+    });
+    
+    return pixels;
+}
+
 void ofxBaseFont::drawString(const std::u32string &utf32_character, const float &x, const float &y, const float &z, const ofxCompFunc &func)
 {
     return drawString(utf32_character, ofPoint(x, y, z), func);
@@ -218,6 +475,11 @@ std::vector<ofRectangle> ofxBaseFont::getGlyphBoundingBoxes(const std::string &s
     return getGlyphBoundingBoxes(utf_converter.from_bytes(src_string), coord, func);
 }
 
+std::string ofxBaseFont::fitString(const std::string &src_string, const float &max_width, const std::string &ellipsis)
+{
+    return utf_converter.to_bytes(fitString(utf_converter.from_bytes(src_string), max_width, utf_converter.from_bytes(ellipsis)));
+}
+
 ofTexture ofxBaseFont::getStringAsTexture(const std::string &src_string, const ofxCompFunc &func)
 {
     return getStringAsTexture(utf_converter.from_bytes(src_string), func);
@@ -228,6 +490,16 @@ std::vector<ofPath> ofxBaseFont::getStringAsPath(const std::string &src_string,
     return getStringAsPath(utf_converter.from_bytes(src_string), func);
 }
 
+ofPixels ofxBaseFont::getStringAsPixels(const std::string &src_string, const ofxCompFunc &func)
+{
+    return getStringAsPixels(utf_converter.from_bytes(src_string), func);
+}
+
+ofPixels ofxBaseFont::getStringAsPixels(const std::string &src_string, const ofColor &color, const ofxCompFunc &func)
+{
+    return getStringAsPixels(utf_converter.from_bytes(src_string), color, func);
+}
+
 void ofxBaseFont::drawString(const std::string &src_string, const float &x, const float &y, const float &z, const ofxCompFunc &func)
 {
     return drawString(src_string, ofPoint(x, y, z), func);
@@ -278,16 +550,78 @@ std::vector<ofRectangle> ofxBaseFont::getGlyphBoundingBoxes(const std::string &s
     return getGlyphBoundingBoxes(utf_converter.from_bytes(src_string), ofPoint(x, y, 0), func);
 }
 
-std::vector<ofxMixedFontUtil::ofxGlyphData> ofxBaseFont::typesetString(const std::u32string &utf32_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func)
+static void AppendGlyphRun(ofxBaseFont &font, const std::u32string &utf32_string, const int &string_offset, const int &bidi_level, std::vector<ofxGlyphData> &glyph_list)
 {
-    std::vector<ofxMixedFontUtil::ofxGlyphData> glyph_list;
     for (int index = 0; index < utf32_string.length();) {
-        int length = 0;
-        glyph_list.push_back(makeGlyphData(utf32_string, index, length));
-        index += (length > 0) ? length : 1;
+        const std::size_t first_glyph = glyph_list.size();
+        int length = font.appendGlyphData(utf32_string, index, glyph_list);
+        const int end = std::min<int>(index + std::max(1, length), utf32_string.length());
+        for (std::size_t i = first_glyph; i < glyph_list.size(); ++i) {
+            // Note: A glyph whose index is out of the characters of this call (ex. of a font which doesn't set it) gets the first of them
+            ofxGlyphData &glyph = glyph_list[i];
+            if (glyph.string_index < index || end <= glyph.string_index) {
+                glyph.string_index = index;
+            }
+            glyph.string_index += string_offset;
+            glyph.bidi_level = bidi_level;
+        }
+        index = end;
     }
-    
+}
+
+void ofxBaseFont::typesetGlyphs(const std::u32string &utf32_string, std::vector<ofxGlyphData> &glyph_list)
+{
+    prepareTypeset();
+    const std::size_t config = getTypesetConfigHash();
+    const std::size_t hash = combineHash(std::hash<std::u32string>()(utf32_string), config);
+    const ofxTypesetCacheKeyRef key_ref = { utf32_string, config };
+    const std::vector<ofxMixedFontUtil::ofxGlyphData> *cached_glyph_list = typeset_cache_.find(hash, key_ref);
+    if (cached_glyph_list) {
+        // Note: Assignment reuses the capacity of glyph_list
+        glyph_list = *cached_glyph_list;
+    }
+    else {
+        glyph_list.clear();
+        if (!needsBidiResolution(utf32_string, base_direction_)) {
+            AppendGlyphRun(*this, utf32_string, 0, 0, glyph_list);
+        }
+        else {
+            // Note: Each directional run is typeset separately, so that a shaping run never mixes directions
+            resolveBidiLevels(utf32_string, base_direction_, bidi_levels_);
+            for (int begin = 0; begin < utf32_string.length();) {
+                int end = begin + 1;
+                while (end < utf32_string.length() && bidi_levels_[end] == bidi_levels_[begin]) ++end;
+                
+                const bool is_rtl_run = (bidi_levels_[begin] % 2 == 1);
+                if (begin == 0 && end == utf32_string.length() && !is_rtl_run) {
+                    AppendGlyphRun(*this, utf32_string, 0, bidi_levels_[begin], glyph_list);
+                }
+                else {
+                    bidi_run_buffer_.assign(utf32_string, begin, end - begin);
+                    if (is_rtl_run) {
+                        // Note: L4. Glyphs keep the mirrored character, since a font looks up the glyph by it.
+                        std::transform(bidi_run_buffer_.begin(), bidi_run_buffer_.end(), bidi_run_buffer_.begin(), getBidiMirroringGlyph);
+                    }
+                    AppendGlyphRun(*this, bidi_run_buffer_, begin, bidi_levels_[begin], glyph_list);
+                }
+                begin = end;
+            }
+        }
+        const ofxTypesetCacheKey key = { utf32_string, config };
+        typeset_cache_.insert(hash, key, glyph_list);
+    }
+}
+
+void ofxBaseFont::typesetString(const std::u32string &utf32_string, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list, const ofxCompFunc &func)
+{
+    typesetGlyphs(utf32_string, glyph_list);
     func(shared_from_this(), coord, glyph_list);
+}
+
+std::vector<ofxGlyphData> ofxBaseFont::typesetString(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func)
+{
+    std::vector<ofxGlyphData> glyph_list;
+    typesetString(utf32_string, coord, glyph_list, func);
     
     return glyph_list;
 }
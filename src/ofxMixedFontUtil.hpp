@@ -1,16 +1,23 @@
 #pragma once
 
 #include "ofTypes.h"
+#include "ofxMixedFontLRUCache.hpp"
+#include "ofxMixedFontBidi.hpp"
 
 #include <string>
 #include <vector>
 #include <locale>
 #include <codecvt>
 #include <memory>
+#include <atomic>
 
 class ofTexture;
 class ofPath;
 class ofRectangle;
+template<typename T> class ofPixels_;
+typedef ofPixels_<unsigned char> ofPixels;
+template<typename T> class ofColor_;
+typedef ofColor_<unsigned char> ofColor;
 
 namespace ofxMixedFontUtil {
 
@@ -20,6 +27,10 @@ static const std::string VERSION = "16.10.1";
 static const float PT_PER_INCH = 72.0;
 static const float DPI = 96.0;
 
+// Note: getStringAsPixels() composes images larger than this on multiple threads
+static const int PARALLEL_COMPOSITION_MIN_PIXELS = 512 * 512;
+static const int COMPOSITION_TILE_SIZE = 256;
+
 static std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> utf_converter;
 const std::u32string convertStringToU32string(const std::string &src);
 
@@ -36,6 +47,7 @@ class ofxBaseFont;
 
 typedef struct {
     std::u32string code_point;
+    int glyph_id; // Note: glyph index in the font file, or -1
     int height;
     int width;
     int bearing_x;
@@ -50,8 +62,48 @@ typedef struct {
     std::weak_ptr<ofxBaseFont> font;
     ofxGlyphProps props;
     ofPoint coord;
+    int bidi_level; // Note: UAX #9 embedding level set by typesetString()
+    int string_index; // Note: index of the first character of the cluster of the glyph in the typeset string, set by appendGlyphData()
 } ofxGlyphData;
 
+typedef struct {
+    std::u32string text;
+    std::size_t config;
+} ofxTypesetCacheKey;
+
+typedef struct {
+    const std::u32string &text;
+    std::size_t config;
+} ofxTypesetCacheKeyRef;
+
+inline bool operator==(const ofxTypesetCacheKey &key, const ofxTypesetCacheKeyRef &key_ref)
+{
+    return key.config == key_ref.config && key.text == key_ref.text;
+}
+
+static const std::size_t DEFAULT_TYPESET_CACHE_CAPACITY = 256;
+
+inline float getGlyphAdvance(const ofxFontProps &font_props, const ofxGlyphProps &glyph_props)
+{
+    if (glyph_props.code_point.length() == 1) {
+        switch (glyph_props.code_point[0]) {
+            case U'\n':
+                return 0.f;
+            case U' ':
+                return font_props.x_ppem / 2.f;
+            case U'\u3000':
+                return font_props.x_ppem;
+            default:
+                break;
+        }
+    }
+    
+    return glyph_props.advance;
+}
+
+// Note: Glyphs stay in logical order, and glyphs of a line [begin, end) are moved to their visual positions
+void reorderGlyphsByBidiLevels(const ofxFontProps &font_props, std::vector<ofxGlyphData> &glyph_list, const int &begin, const int &end);
+
 typedef std::function<void (const std::shared_ptr<ofxBaseFont> &font, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list)> ofxCompFunc;
 void defaultCompFunc(const std::shared_ptr<ofxBaseFont> &font, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list);
 
@@ -72,10 +124,29 @@ public:
     virtual ofxFontProps getFontProps() const final;
     virtual float getDPI() const final;
     
+    virtual void setClipRectangle(const ofRectangle &clip_rectangle);
+    virtual void clearClipRectangle();
+    virtual bool hasClipRectangle() const final;
+    
+    virtual void setTypesetCacheCapacity(const std::size_t &capacity) final;
+    virtual void clearTypesetCache() final;
+    virtual ofxCacheStats getTypesetCacheStats() const final;
+    virtual std::size_t getTypesetConfigHash() const;
+    
+    virtual void setBaseDirection(const ofxBidiDirection &direction) final;
+    virtual ofxBidiDirection getBaseDirection() const final;
+    
     virtual ofxGlyphData makeGlyphData(const std::u32string &utf32_character, const int &index, int &length) = 0;
+    virtual int appendGlyphData(const std::u32string &utf32_string, const int &index, std::vector<ofxGlyphData> &glyph_list);
+    virtual void typesetString(const std::u32string &utf32_string, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list, const ofxCompFunc &func = defaultCompFunc) final;
+    virtual std::vector<ofxGlyphData> typesetString(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func = defaultCompFunc) final;
+    template<typename CompPolicy> void typesetString(const std::u32string &utf32_string, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list, const CompPolicy &policy);
     virtual void drawGlyphs(const std::vector<ofxGlyphData> &glyph_list) = 0;
     virtual void drawGlyphsWithTexture(const std::vector<ofxGlyphData> &glyph_list) = 0;
     virtual void drawGlyphsWithPath(const std::vector<ofxGlyphData> &glyph_list) = 0;
+    virtual void drawGlyphsIntoPixels(const std::vector<ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color) {};
+    virtual void loadGlyphBitmaps(const std::vector<ofxGlyphData> &glyph_list) {};
+    virtual void drawLoadedGlyphsIntoPixels(const std::vector<ofxGlyphData> &glyph_list, ofPixels &pixels, const ofPoint &offset, const ofColor &color, const ofRectangle &region) const {};
     
     // utf32
     virtual void drawString(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func = defaultCompFunc) = 0;
@@ -84,8 +155,14 @@ public:
     virtual ofRectangle getStringBoundingBox(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func = defaultCompFunc) final;
     virtual std::vector<ofRectangle> getGlyphBoundingBoxes(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func = defaultCompFunc) final;
 
+    // Note: Cuts the string to fit in max_width with the ellipsis, by a binary search on prefix sums of advances (single line)
+    virtual std::u32string fitString(const std::u32string &utf32_string, const float &max_width, const std::u32string &ellipsis = U"\u2026") final;
+    virtual void fitStrings(const std::vector<std::u32string> &utf32_strings, const float &max_width, std::vector<std::u32string> &fitted_strings, const std::u32string &ellipsis = U"\u2026") final;
+    
     virtual ofTexture getStringAsTexture(const std::u32string &utf32_string, const ofxCompFunc &func = defaultCompFunc) = 0;
     virtual std::vector<ofPath> getStringAsPath(const std::u32string &utf32_string, const ofxCompFunc &func = defaultCompFunc) = 0;
+    virtual ofPixels getStringAsPixels(const std::u32string &utf32_string, const ofxCompFunc &func = defaultCompFunc) final;
+    virtual ofPixels getStringAsPixels(const std::u32string &utf32_string, const ofColor &color, const ofxCompFunc &func = defaultCompFunc) final;
     
     virtual void drawString(const std::u32string &utf32_string, const float &x, const float &y, const float &z = 0.f, const ofxCompFunc &func = defaultCompFunc) final;
     virtual void drawStringWithTexture(const std::u32string &utf32_string, const float &x, const float &y, const float &z = 0.f, const ofxCompFunc &func = defaultCompFunc) final;
@@ -106,8 +183,12 @@ public:
     virtual ofRectangle getStringBoundingBox(const std::string &src_string, const ofPoint &coord, const ofxCompFunc &func = defaultCompFunc) final;
     virtual std::vector<ofRectangle> getGlyphBoundingBoxes(const std::string &src_string, const ofPoint &coord, const ofxCompFunc &func = defaultCompFunc) final;
 
+    virtual std::string fitString(const std::string &src_string, const float &max_width, const std::string &ellipsis = "\u2026") final;
+    
     virtual ofTexture getStringAsTexture(const std::string &src_string, const ofxCompFunc &func = defaultCompFunc) final;
     virtual std::vector<ofPath> getStringAsPath(const std::string &src_string, const ofxCompFunc &func = defaultCompFunc) final;
+    virtual ofPixels getStringAsPixels(const std::string &src_string, const ofxCompFunc &func = defaultCompFunc) final;
+    virtual ofPixels getStringAsPixels(const std::string &src_string, const ofColor &color, const ofxCompFunc &func = defaultCompFunc) final;
     
     virtual void drawString(const std::string &src_string, const float &x, const float &y, const float &z = 0.f, const ofxCompFunc &func = defaultCompFunc) final;
     virtual void drawStringWithTexture(const std::string &src_string, const float &x, const float &y, const float &z = 0.f, const ofxCompFunc &func = defaultCompFunc) final;
@@ -126,13 +207,75 @@ protected:
     virtual int setSpaceGlyphProps() = 0;
     virtual int setFullWidthSpaceGlyphProps() = 0;
     virtual int setLineFeedGlyphProps() = 0;
-    virtual std::vector<ofxGlyphData> typesetString(const std::u32string &utf32_string, const ofPoint &coord, const ofxCompFunc &func) final;
+    virtual bool glyphIsVisible(const ofxGlyphData &glyph) const final;
+    virtual void prepareTypeset() {}; // Note: called before each typeset, so that a font can update its state (ex. fonts which became ready)
+    virtual void typesetGlyphs(const std::u32string &utf32_string, std::vector<ofxGlyphData> &glyph_list) final;
+    virtual float getStringAdvance(const std::u32string &utf32_string) final;
+    virtual int findFitLength(const std::u32string &utf32_string, const float &max_width, const float &ellipsis_width) final;
+    
+    // Note: Takes typeset_buffer_ while a string is typeset and used, so that a comp func which typesets with the same font
+    //       (ex. getStringBoundingBox() to center a line) gets a buffer of its own instead of overwriting the one being composed
+    class ScopedTypesetBuffer
+    {
+    public:
+        explicit ScopedTypesetBuffer(std::vector<ofxGlyphData> &buffer) : buffer_(buffer) { glyphs.swap(buffer_); };
+        ~ScopedTypesetBuffer() { glyphs.swap(buffer_); };
+        
+        ScopedTypesetBuffer(const ScopedTypesetBuffer &) = delete;
+        ScopedTypesetBuffer &operator=(const ScopedTypesetBuffer &) = delete;
+        
+        std::vector<ofxGlyphData> glyphs;
+        
+    private:
+        std::vector<ofxGlyphData> &buffer_;
+    };
     
     ofxFontProps font_props_;
-    bool is_ready_;
+    std::atomic<bool> is_ready_; // Note: set last, since a font may be loaded on another thread
     bool texture_is_enabled_;
     bool path_is_enabled_;
+    std::shared_ptr<ofRectangle> clip_rectangle_;
+    ofxLRUCache<ofxTypesetCacheKey, std::vector<ofxGlyphData>> typeset_cache_;
+    std::vector<ofxGlyphData> typeset_buffer_; // Note: reused by draw and measure functions to avoid allocations per string (see ScopedTypesetBuffer)
+    ofxBidiDirection base_direction_;
+    std::vector<unsigned char> bidi_levels_;
+    std::u32string bidi_run_buffer_;
+    std::vector<float> fit_advance_sums_;
+    std::vector<int> fit_string_offsets_;
 
 };
 
+// Note: Any callable with the signature of ofxCompFunc can be passed to the template typesetString(), and it is inlined there
+template<typename CompPolicy>
+void ofxBaseFont::typesetString(const std::u32string &utf32_string, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list, const CompPolicy &policy)
+{
+    typesetGlyphs(utf32_string, glyph_list);
+    policy(shared_from_this(), coord, glyph_list);
+}
+
+struct ofxDefaultCompPolicy
+{
+    void operator()(const std::shared_ptr<ofxBaseFont> &font, const ofPoint &coord, std::vector<ofxGlyphData> &glyph_list) const
+    {
+        const ofxFontProps font_props = font->getFontProps();
+        ofPoint pos = coord;
+        int line_begin = 0;
+        for (int i = 0; i < glyph_list.size(); ++i) {
+            ofxGlyphData &glyph = glyph_list[i];
+            glyph.coord = pos;
+            
+            if (glyph.props.code_point.length() == 1 && glyph.props.code_point[0] == U'\n') {
+                reorderGlyphsByBidiLevels(font_props, glyph_list, line_begin, i + 1);
+                line_begin = i + 1;
+                pos.x = coord.x;
+                pos.y += font_props.line_height;
+            }
+            else {
+                pos.x += getGlyphAdvance(font_props, glyph.props);
+            }
+        }
+        reorderGlyphsByBidiLevels(font_props, glyph_list, line_begin, glyph_list.size());
+    }
+};
+
 }
@@ -0,0 +1,163 @@
+#include "ofxTextLayout.hpp"
+
+#include "ofRectangle.h"
+
+#include <algorithm>
+#include <numeric>
+
+ofxTextLayout::ofxTextLayout()
+: font_props_(), coord_(0, 0), text_length_(0)
+{
+    
+}
+
+void ofxTextLayout::build(const ofxBaseFontPtr &font, const std::u32string &utf32_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func)
+{
+    font_props_ = font->getFontProps();
+    coord_ = coord;
+    font->typesetString(utf32_string, coord, glyph_list_, func);
+    buildIndex(utf32_string);
+}
+
+void ofxTextLayout::build(const ofxBaseFontPtr &font, const std::string &src_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func)
+{
+    build(font, ofxMixedFontUtil::utf_converter.from_bytes(src_string), coord, func);
+}
+
+void ofxTextLayout::build(const ofxMixedFontUtil::ofxFontProps &font_props, const std::u32string &utf32_string, const ofPoint &coord, const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list)
+{
+    font_props_ = font_props;
+    coord_ = coord;
+    glyph_list_ = glyph_list;
+    buildIndex(utf32_string);
+}
+
+const std::vector<ofxMixedFontUtil::ofxGlyphData> &ofxTextLayout::getGlyphs() const
+{
+    return glyph_list_;
+}
+
+int ofxTextLayout::getLineCount() const
+{
+    return lines_.size();
+}
+
+int ofxTextLayout::getLineIndex(const int &index) const
+{
+    if (glyph_list_.empty()) return 0;
+    
+    auto found = std::upper_bound(glyph_offsets_.begin(), glyph_offsets_.end() - 1, index);
+    return glyph_lines_[std::max(0, static_cast<int>(found - glyph_offsets_.begin()) - 1)];
+}
+
+int ofxTextLayout::getIndexAtPoint(const ofPoint &point) const
+{
+    if (lines_.empty()) return 0;
+    
+    const Line &line = lines_[findLine(point.y)];
+    auto found = std::upper_bound(visual_lefts_.begin() + line.visual_begin, visual_lefts_.begin() + line.visual_end, point.x);
+    const int visual_index = std::max(line.visual_begin, static_cast<int>(found - visual_lefts_.begin()) - 1);
+    const int glyph = visual_glyphs_[visual_index];
+    
+    // Note: The trailing half of a glyph puts the caret after it in logical order
+    const bool is_rtl = (glyph_list_[glyph].bidi_level & 1);
+    const bool is_right_half = (point.x >= visual_lefts_[visual_index] + glyph_advances_[glyph] / 2.f);
+    if (is_right_half == is_rtl || glyph_list_[glyph].props.code_point == U"\n") {
+        return glyph_offsets_[glyph];
+    }
+    
+    return *std::upper_bound(glyph_offsets_.begin() + glyph, glyph_offsets_.end() - 1, glyph_offsets_[glyph]);
+}
+
+ofRectangle ofxTextLayout::getCaretRect(const int &index) const
+{
+    if (glyph_list_.empty()) {
+        return ofRectangle(coord_.x, coord_.y - font_props_.ascender_height, 1.f, font_props_.line_height);
+    }
+    
+    const int clamped_index = std::max(0, std::min(index, text_length_));
+    auto found = std::upper_bound(glyph_offsets_.begin(), glyph_offsets_.end() - 1, clamped_index);
+    int glyph = std::max(0, static_cast<int>(found - glyph_offsets_.begin()) - 1);
+    
+    if (clamped_index < text_length_ || glyph_offsets_[glyph] == text_length_) {
+        // Note: The first glyph of a cluster has the caret position of the cluster
+        glyph = std::lower_bound(glyph_offsets_.begin(), glyph_offsets_.begin() + glyph, glyph_offsets_[glyph]) - glyph_offsets_.begin();
+        const Line &line = lines_[glyph_lines_[glyph]];
+        return ofRectangle(getLeadingEdge(glyph), line.top, 1.f, line.bottom - line.top);
+    }
+    
+    const Line &line = lines_[glyph_lines_[glyph]];
+    if (glyph_list_[glyph].props.code_point == U"\n") {
+        return ofRectangle(coord_.x, line.bottom, 1.f, line.bottom - line.top);
+    }
+    return ofRectangle(getTrailingEdge(glyph), line.top, 1.f, line.bottom - line.top);
+}
+
+void ofxTextLayout::buildIndex(const std::u32string &utf32_string)
+{
+    text_length_ = utf32_string.length();
+    glyph_offsets_.clear();
+    glyph_lines_.clear();
+    glyph_advances_.clear();
+    lines_.clear();
+    visual_glyphs_.resize(glyph_list_.size());
+    visual_lefts_.resize(glyph_list_.size());
+    
+    // Note: Glyphs of a shaped cluster have the same string index. Offsets are kept sorted for binary searches.
+    for (int i = 0; i < glyph_list_.size(); ++i) {
+        const ofxMixedFontUtil::ofxGlyphData &glyph = glyph_list_[i];
+        const int offset = std::max(0, std::min(glyph.string_index, text_length_));
+        glyph_offsets_.push_back(glyph_offsets_.empty() ? offset : std::max(glyph_offsets_.back(), offset));
+        glyph_advances_.push_back(ofxMixedFontUtil::getGlyphAdvance(font_props_, glyph.props));
+        
+        // Note: A composition function puts a line at one baseline, and lines are in logical order
+        if (i == 0 || glyph.coord.y != glyph_list_[i - 1].coord.y) {
+            if (!lines_.empty()) {
+                lines_.back().visual_end = i;
+            }
+            Line line;
+            line.top = glyph.coord.y - font_props_.ascender_height;
+            line.bottom = line.top + font_props_.line_height;
+            line.visual_begin = i;
+            lines_.push_back(line);
+        }
+        glyph_lines_.push_back(lines_.size() - 1);
+    }
+    glyph_offsets_.push_back(text_length_);
+    if (!lines_.empty()) {
+        lines_.back().visual_end = glyph_list_.size();
+    }
+    
+    for (auto &line : lines_) {
+        auto begin = visual_glyphs_.begin() + line.visual_begin;
+        auto end = visual_glyphs_.begin() + line.visual_end;
+        std::iota(begin, end, line.visual_begin);
+        std::stable_sort(begin, end, [&](const int &a, const int &b) {
+            return glyph_list_[a].coord.x < glyph_list_[b].coord.x;
+        });
+        for (int i = line.visual_begin; i < line.visual_end; ++i) {
+            visual_lefts_[i] = glyph_list_[visual_glyphs_[i]].coord.x;
+        }
+    }
+}
+
+float ofxTextLayout::getLeadingEdge(const int &glyph) const
+{
+    const float x = glyph_list_[glyph].coord.x;
+    return (glyph_list_[glyph].bidi_level & 1) ? x + glyph_advances_[glyph] : x;
+}
+
+float ofxTextLayout::getTrailingEdge(const int &glyph) const
+{
+    const float x = glyph_list_[glyph].coord.x;
+    return (glyph_list_[glyph].bidi_level & 1) ? x : x + glyph_advances_[glyph];
+}
+
+int ofxTextLayout::findLine(const float &y) const
+{
+    auto found = std::upper_bound(lines_.begin(), lines_.end(), y, [](const float &value, const Line &line) {
+        return value < line.bottom;
+    });
+    
+    return std::min(static_cast<int>(found - lines_.begin()), static_cast<int>(lines_.size()) - 1);
+}
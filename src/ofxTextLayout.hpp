@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "ofxMixedFontUtil.hpp"
+
+class ofRectangle;
+
+typedef std::shared_ptr<ofxMixedFontUtil::ofxBaseFont> ofxBaseFontPtr;
+
+// Note: ofxTextLayout keeps a typeset string with the y extents of its lines and the x edges of its glyphs in visual order,
+//       so that hit-testing and caret queries are binary searches instead of scanning getGlyphBoundingBoxes().
+class ofxTextLayout
+{
+public:
+    ofxTextLayout();
+    virtual ~ofxTextLayout() {};
+
+    void build(const ofxBaseFontPtr &font, const std::u32string &utf32_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func = ofxMixedFontUtil::defaultCompFunc);
+    void build(const ofxBaseFontPtr &font, const std::string &src_string, const ofPoint &coord, const ofxMixedFontUtil::ofxCompFunc &func = ofxMixedFontUtil::defaultCompFunc);
+    // Note: glyph_list must be typeset from utf32_string (ex. by ofxBaseFont::typesetString()), since the string index of each glyph is used
+    void build(const ofxMixedFontUtil::ofxFontProps &font_props, const std::u32string &utf32_string, const ofPoint &coord, const std::vector<ofxMixedFontUtil::ofxGlyphData> &glyph_list);
+
+    const std::vector<ofxMixedFontUtil::ofxGlyphData> &getGlyphs() const;
+    int getLineCount() const;
+    int getLineIndex(const int &index) const;
+    int getIndexAtPoint(const ofPoint &point) const;
+    ofRectangle getCaretRect(const int &index) const;
+
+private:
+    typedef struct {
+        float top;
+        float bottom;
+        int visual_begin; // Note: [visual_begin, visual_end) of visual_glyphs_
+        int visual_end;
+    } Line;
+
+    void buildIndex(const std::u32string &utf32_string);
+    float getLeadingEdge(const int &glyph) const;
+    float getTrailingEdge(const int &glyph) const;
+    int findLine(const float &y) const;
+
+    ofxMixedFontUtil::ofxFontProps font_props_;
+    ofPoint coord_;
+    int text_length_;
+    std::vector<ofxMixedFontUtil::ofxGlyphData> glyph_list_;
+    std::vector<int> glyph_offsets_; // Note: index of the first character of each glyph, and text length at the end
+    std::vector<int> glyph_lines_;
+    std::vector<float> glyph_advances_;
+    std::vector<Line> lines_;
+    std::vector<int> visual_glyphs_; // Note: glyphs of each line sorted by x
+    std::vector<float> visual_lefts_;
+
+};
@@ -0,0 +1,475 @@
+// Note: ofxMixedFontBaker rasterizes glyphs the same way as ofxFT2Font, and writes atlas cache files which ofxFT2Font::loadAtlasCache() reads,
+//       so that an app can ship pre-baked glyphs of known strings instead of rasterizing them on startup.
+//       It doesn't depend on openFrameworks.
+
+#include "ofxMixedFontAtlasCache.hpp"
+
+#include <algorithm>
+#include <codecvt>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <locale>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_TRUETYPE_TABLES_H
+
+#include <png.h>
+
+using namespace ofxMixedFontUtil;
+
+// Note: the same values as ofxMixedFontUtil::DPI, ofxMixedFontUtil::PT_PER_INCH and ofxFT2Font::ATLAS_TEXTURE_SIZE (GL_MAX_TEXTURE_SIZE)
+static const float DPI = 96.0;
+static const float PT_PER_INCH = 72.0;
+static const int ATLAS_SIZE = 0x0D33;
+
+typedef struct {
+    std::vector<std::string> font_files;
+    std::vector<float> font_sizes_pt;
+    int face_index;
+    std::u32string characters;
+    std::string output_directory;
+    bool writes_png;
+} Options;
+
+typedef struct {
+    FT_Face ft_face;
+    bool is_mono_font;
+    int channels;
+    float internal_scale_factor;
+    std::vector<ofxAtlasCacheGlyph> glyphs;
+    std::vector<std::u32string> glyph_code_points;
+    std::map<std::u32string, std::uint32_t> sequence_indices;
+    std::unordered_map<int, int> glyph_id_indices;
+    std::vector<unsigned char> pixels; // Note: rows [0, next_offset_y) of the atlas
+    int offset_x;
+    int offset_y;
+    int next_offset_y;
+} Baker;
+
+static void printUsage()
+{
+    std::fprintf(stderr,
+                 "usage: ofxMixedFontBaker [options] font_file...\n"
+                 "  -s, --size PT          font size in points (repeatable, default 32)\n"
+                 "  -i, --face-index N     face index in a font collection (default 0)\n"
+                 "  -c, --chars FILE       UTF-8 text file of the characters to bake (repeatable)\n"
+                 "  -r, --range FIRST-LAST hexadecimal Unicode range to bake (ex. 0020-007E, repeatable)\n"
+                 "  -o, --output DIR       output directory (default .)\n"
+                 "      --png              also write each atlas as PNG for inspection\n"
+                 "Writes DIR/<font name>_<size>.atlas (<font name>_<face index>_<size>.atlas for other faces than 0).\n");
+}
+
+static bool readFile(const std::string &file_path, std::vector<unsigned char> &data)
+{
+    std::ifstream stream(file_path, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+    data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    
+    return true;
+}
+
+static int parseOptions(int argc, char *argv[], Options &options)
+{
+    options.face_index = 0;
+    options.output_directory = ".";
+    options.writes_png = false;
+    
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+        if ((arg == "-s" || arg == "--size") && has_value) {
+            options.font_sizes_pt.push_back(std::strtof(argv[++i], nullptr));
+        }
+        else if ((arg == "-i" || arg == "--face-index") && has_value) {
+            options.face_index = std::atoi(argv[++i]);
+        }
+        else if ((arg == "-c" || arg == "--chars") && has_value) {
+            std::vector<unsigned char> text;
+            if (!readFile(argv[++i], text)) {
+                std::fprintf(stderr, "couldn't read \"%s\"\n", argv[i]);
+                return -1;
+            }
+            try {
+                std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> utf_converter;
+                options.characters += utf_converter.from_bytes(std::string(text.begin(), text.end()));
+            }
+            catch (const std::range_error &) {
+                std::fprintf(stderr, "\"%s\" isn't UTF-8\n", argv[i]);
+                return -1;
+            }
+        }
+        else if ((arg == "-r" || arg == "--range") && has_value) {
+            unsigned long first = 0, last = 0;
+            if (std::sscanf(argv[++i], "%lx-%lx", &first, &last) != 2 || first > last || last > 0x10FFFF) {
+                std::fprintf(stderr, "invalid range \"%s\"\n", argv[i]);
+                return -1;
+            }
+            for (unsigned long code_point = first; code_point <= last; ++code_point) {
+                options.characters.push_back(code_point);
+            }
+        }
+        else if ((arg == "-o" || arg == "--output") && has_value) {
+            options.output_directory = argv[++i];
+        }
+        else if (arg == "--png") {
+            options.writes_png = true;
+        }
+        else if (!arg.empty() && arg[0] != '-') {
+            options.font_files.push_back(arg);
+        }
+        else {
+            return -1;
+        }
+    }
+    if (options.font_sizes_pt.empty()) {
+        options.font_sizes_pt.push_back(32);
+    }
+    
+    return options.font_files.empty() ? -1 : 0;
+}
+
+static bool isColorBitmapFont(FT_Face ft_face)
+{
+    for (FT_ULong tag : { FT_MAKE_TAG('C', 'B', 'D', 'T'), FT_MAKE_TAG('s', 'b', 'i', 'x') }) {
+        FT_ULong length = 0;
+        FT_Load_Sfnt_Table(ft_face, tag, 0, nullptr, &length);
+        if (length > 0) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+// Note: the same as setFTCharSize() and selectFTCharSize() of ofxFT2Font
+static bool setCharSize(Baker &baker, const float &font_size_pt)
+{
+    const int int_font_size_pt = font_size_pt;
+    if (baker.is_mono_font) {
+        return FT_Set_Char_Size(baker.ft_face, int_font_size_pt << 6, int_font_size_pt << 6, DPI, DPI) == 0;
+    }
+    if (baker.ft_face->num_fixed_sizes == 0) {
+        return true;
+    }
+    
+    float font_size_px = int_font_size_pt * static_cast<int>(DPI) / PT_PER_INCH;
+    int best_match = 0;
+    int diff = std::abs(font_size_px - baker.ft_face->available_sizes[0].width);
+    for (int i = 1; i < baker.ft_face->num_fixed_sizes; ++i) {
+        int ndiff = std::abs(font_size_px - baker.ft_face->available_sizes[i].width);
+        if (ndiff < diff) {
+            best_match = i;
+            diff = ndiff;
+        }
+    }
+    
+    return FT_Select_Size(baker.ft_face, best_match) == 0;
+}
+
+static FT_Int32 getLoadFlags(const Baker &baker)
+{
+    return baker.is_mono_font ? FT_LOAD_DEFAULT : FT_LOAD_COLOR;
+}
+
+// Note: the same as ofxFT2Font::loadGlyphById()
+static int loadGlyphById(Baker &baker, const int &glyph_id, const std::u32string &code_point)
+{
+    if (FT_Load_Glyph(baker.ft_face, glyph_id, getLoadFlags(baker)) != 0) {
+        return -2;
+    }
+    
+    const FT_Glyph_Metrics &metrics = baker.ft_face->glyph->metrics;
+    const float &scale = baker.internal_scale_factor;
+    ofxAtlasCacheGlyph glyph;
+    std::memset(&glyph, 0, sizeof(glyph));
+    glyph.glyph_id = glyph_id;
+    glyph.height = (metrics.height >> 6) * scale;
+    glyph.width = (metrics.width >> 6) * scale;
+    glyph.bearing_x = (metrics.horiBearingX >> 6) * scale;
+    glyph.bearing_y = (metrics.horiBearingY >> 6) * scale;
+    glyph.advance = (metrics.horiAdvance >> 6) * scale;
+    glyph.vertical_bearing_x = (metrics.vertBearingX >> 6) * scale;
+    glyph.vertical_bearing_y = (metrics.vertBearingY >> 6) * scale;
+    glyph.vertical_advance = (metrics.vertAdvance >> 6) * scale;
+    baker.glyphs.push_back(glyph);
+    baker.glyph_code_points.push_back(code_point);
+    baker.glyph_id_indices[glyph_id] = baker.glyphs.size() - 1;
+    
+    return baker.glyphs.size() - 1;
+}
+
+// Note: the same as ofxFT2Font::makeSpaceGlyphProps()
+static void makeSpaceGlyph(Baker &baker, const char32_t &code_point, const float &scale)
+{
+    const float x_ppem = baker.ft_face->size->metrics.x_ppem * baker.internal_scale_factor;
+    const float y_ppem = baker.ft_face->size->metrics.y_ppem * baker.internal_scale_factor;
+    ofxAtlasCacheGlyph glyph;
+    std::memset(&glyph, 0, sizeof(glyph));
+    glyph.glyph_id = -1;
+    glyph.advance = x_ppem * scale;
+    glyph.vertical_advance = y_ppem * scale;
+    baker.glyphs.push_back(glyph);
+    baker.glyph_code_points.push_back(std::u32string(1, code_point));
+    baker.sequence_indices[std::u32string(1, code_point)] = baker.glyphs.size() - 1;
+}
+
+// Note: the same as ofxFT2Font::getGlyphIndex()
+static void addCharacter(Baker &baker, const char32_t &code_point)
+{
+    const std::u32string key(1, code_point);
+    if (baker.sequence_indices.count(key) > 0) {
+        return;
+    }
+    
+    int index = 0;
+    FT_UInt glyph_id = FT_Get_Char_Index(baker.ft_face, code_point);
+    if (glyph_id != 0) {
+        auto found = baker.glyph_id_indices.find(glyph_id);
+        index = (found != baker.glyph_id_indices.end()) ? found->second : std::max(0, loadGlyphById(baker, glyph_id, key));
+    }
+    baker.sequence_indices[key] = index;
+}
+
+static void appendAtlasRows(Baker &baker, const int &row_count)
+{
+    const std::size_t row_size = static_cast<std::size_t>(ATLAS_SIZE) * baker.channels;
+    for (int i = 0; i < row_count; ++i) {
+        std::size_t offset = baker.pixels.size();
+        baker.pixels.resize(offset + row_size, 0);
+        if (baker.is_mono_font) {
+            // Note: ofxFT2Font fills the luminance channel of its atlas with 255
+            for (std::size_t j = offset; j < offset + row_size; j += 2) {
+                baker.pixels[j] = 255;
+            }
+        }
+    }
+}
+
+// Note: the same packing as pasteIntoAtlasPixels() and ofxFT2Font::rasterizeGlyph()
+static int rasterizeGlyph(Baker &baker, const int &glyph_index)
+{
+    ofxAtlasCacheGlyph &glyph = baker.glyphs[glyph_index];
+    if (FT_Load_Glyph(baker.ft_face, glyph.glyph_id, getLoadFlags(baker)) != 0) {
+        return 0;
+    }
+    FT_Render_Glyph(baker.ft_face->glyph, FT_RENDER_MODE_NORMAL);
+    
+    const FT_Bitmap &bitmap = baker.ft_face->glyph->bitmap;
+    const int width = bitmap.width;
+    const int rows = bitmap.rows;
+    if (baker.offset_x + width > ATLAS_SIZE) {
+        baker.offset_x = 0;
+        baker.offset_y = baker.next_offset_y + 1;
+    }
+    if (baker.offset_y + rows > ATLAS_SIZE) {
+        return -1;
+    }
+    
+    const int stored_rows = baker.pixels.size() / (static_cast<std::size_t>(ATLAS_SIZE) * baker.channels);
+    if (baker.offset_y + rows > stored_rows) {
+        appendAtlasRows(baker, baker.offset_y + rows - stored_rows);
+    }
+    for (int y = 0; y < rows; ++y) {
+        const unsigned char *src = bitmap.buffer + y * bitmap.pitch;
+        unsigned char *dst = &baker.pixels[(static_cast<std::size_t>(baker.offset_y + y) * ATLAS_SIZE + baker.offset_x) * baker.channels];
+        if (baker.is_mono_font) {
+            for (int x = 0; x < width; ++x) {
+                dst[x * 2 + 1] = src[x];
+            }
+        }
+        else {
+            std::memcpy(dst, src, width * 4);
+        }
+    }
+    if (baker.offset_y + rows > baker.next_offset_y) {
+        baker.next_offset_y = baker.offset_y + rows;
+    }
+    
+    glyph.atlas_x = baker.offset_x;
+    glyph.atlas_y = baker.offset_y;
+    glyph.state |= ATLAS_CACHE_GLYPH_BITMAP;
+    baker.offset_x += width + 1;
+    
+    return 0;
+}
+
+static int writePNG(const std::string &file_path, const Baker &baker)
+{
+    std::FILE *file = std::fopen(file_path.c_str(), "wb");
+    if (!file) {
+        return -1;
+    }
+    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    png_infop info = png ? png_create_info_struct(png) : nullptr;
+    if (!info || setjmp(png_jmpbuf(png))) {
+        png_destroy_write_struct(&png, &info);
+        std::fclose(file);
+        return -2;
+    }
+    
+    // Note: Color atlases are BGRA like FreeType's color bitmaps
+    png_init_io(png, file);
+    png_set_IHDR(png, info, ATLAS_SIZE, baker.next_offset_y, 8, baker.is_mono_font ? PNG_COLOR_TYPE_GRAY_ALPHA : PNG_COLOR_TYPE_RGB_ALPHA,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+    if (!baker.is_mono_font) {
+        png_set_bgr(png);
+    }
+    for (int y = 0; y < baker.next_offset_y; ++y) {
+        png_write_row(png, const_cast<png_bytep>(&baker.pixels[static_cast<std::size_t>(y) * ATLAS_SIZE * baker.channels]));
+    }
+    png_write_end(png, nullptr);
+    png_destroy_write_struct(&png, &info);
+    
+    return (std::fclose(file) == 0) ? 0 : -3;
+}
+
+static std::string makeOutputPath(const Options &options, const std::string &font_file, const float &font_size_pt, const std::string &extension)
+{
+    std::string name = font_file.substr(font_file.find_last_of("/\\") + 1);
+    name = name.substr(0, name.find_last_of('.'));
+    if (options.face_index != 0) {
+        name += "_" + std::to_string(options.face_index);
+    }
+    char size[32];
+    std::snprintf(size, sizeof(size), "_%g", font_size_pt);
+    
+    return options.output_directory + "/" + name + size + extension;
+}
+
+static int bake(FT_Library ft_library, const Options &options, const std::string &font_file, const std::vector<unsigned char> &font_data, const float &font_size_pt)
+{
+    Baker baker;
+    if (FT_New_Memory_Face(ft_library, font_data.data(), font_data.size(), options.face_index, &baker.ft_face) != 0) {
+        std::fprintf(stderr, "couldn't open face #%d of \"%s\"\n", options.face_index, font_file.c_str());
+        return -1;
+    }
+    baker.is_mono_font = !isColorBitmapFont(baker.ft_face);
+    baker.channels = baker.is_mono_font ? 2 : 4;
+    baker.internal_scale_factor = 1.0;
+    baker.offset_x = 0;
+    baker.offset_y = 0;
+    baker.next_offset_y = 0;
+    if (!setCharSize(baker, font_size_pt)) {
+        std::fprintf(stderr, "couldn't set size %g to \"%s\"\n", font_size_pt, font_file.c_str());
+        FT_Done_Face(baker.ft_face);
+        return -2;
+    }
+    if (!baker.is_mono_font) {
+        float font_size = font_size_pt * DPI / PT_PER_INCH;
+        baker.internal_scale_factor = font_size / baker.ft_face->size->metrics.x_ppem;
+    }
+    
+    // Note: The glyphs which ofxFT2Font::initialize() loads come first, in the same order
+    if (loadGlyphById(baker, 0, std::u32string(1, 0)) != 0) {
+        makeSpaceGlyph(baker, 0, 1.f);
+    }
+    makeSpaceGlyph(baker, U' ', 0.5f);
+    makeSpaceGlyph(baker, U'　', 1.f);
+    makeSpaceGlyph(baker, U'\n', 0.f);
+    for (auto &code_point : options.characters) {
+        addCharacter(baker, code_point);
+    }
+    for (std::size_t i = 0; i < baker.glyphs.size(); ++i) {
+        if (baker.glyphs[i].glyph_id >= 0 && rasterizeGlyph(baker, i) != 0) {
+            std::fprintf(stderr, "the atlas of \"%s\" at %g pt is full\n", font_file.c_str(), font_size_pt);
+            FT_Done_Face(baker.ft_face);
+            return -3;
+        }
+    }
+    
+    ofxAtlasCacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    FT_Int major = 0, minor = 0, patch = 0;
+    FT_Library_Version(ft_library, &major, &minor, &patch);
+    header.font_hash = hashFontTables(font_data.data(), font_data.size());
+    header.font_file_size = font_data.size();
+    header.font_modification_time = 0; // Note: The font is copied with the app, and its time changes
+    header.face_index = options.face_index;
+    header.font_size_pt = font_size_pt;
+    header.dpi = DPI;
+    header.load_flags = getLoadFlags(baker);
+    header.render_mode = FT_RENDER_MODE_NORMAL;
+    header.freetype_version = major * 10000 + minor * 100 + patch;
+    header.internal_scale_factor = baker.internal_scale_factor;
+    header.atlas_width = ATLAS_SIZE;
+    header.atlas_height = baker.next_offset_y;
+    header.atlas_channels = baker.channels;
+    header.atlas_offset_x = baker.offset_x;
+    header.atlas_offset_y = baker.offset_y;
+    header.next_atlas_offset_y = baker.next_offset_y;
+    
+    std::u32string code_points;
+    for (std::size_t i = 0; i < baker.glyphs.size(); ++i) {
+        baker.glyphs[i].code_point_begin = code_points.length();
+        baker.glyphs[i].code_point_length = baker.glyph_code_points[i].length();
+        code_points += baker.glyph_code_points[i];
+    }
+    std::vector<ofxAtlasCacheSequence> sequences;
+    for (auto &entry : baker.sequence_indices) {
+        ofxAtlasCacheSequence sequence = { static_cast<std::uint32_t>(code_points.length()), static_cast<std::uint32_t>(entry.first.length()), entry.second };
+        code_points += entry.first;
+        sequences.push_back(sequence);
+    }
+    FT_Done_Face(baker.ft_face);
+    
+    const std::string output_path = makeOutputPath(options, font_file, font_size_pt, ".atlas");
+    if (writeAtlasCache(output_path, header, baker.glyphs, sequences, code_points, baker.pixels.data()) != 0) {
+        std::fprintf(stderr, "couldn't write \"%s\"\n", output_path.c_str());
+        return -4;
+    }
+    std::printf("%s: %zu glyphs, %d x %d\n", output_path.c_str(), baker.glyphs.size(), ATLAS_SIZE, baker.next_offset_y);
+    
+    if (options.writes_png && baker.next_offset_y > 0) {
+        const std::string png_path = makeOutputPath(options, font_file, font_size_pt, ".png");
+        if (writePNG(png_path, baker) != 0) {
+            std::fprintf(stderr, "couldn't write \"%s\"\n", png_path.c_str());
+            return -5;
+        }
+    }
+    
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    if (parseOptions(argc, argv, options) != 0) {
+        printUsage();
+        return 2;
+    }
+    
+    FT_Library ft_library;
+    if (FT_Init_FreeType(&ft_library) != 0) {
+        std::fprintf(stderr, "couldn't initialize FreeType\n");
+        return 1;
+    }
+    
+    int result = 0;
+    for (auto &font_file : options.font_files) {
+        std::vector<unsigned char> font_data;
+        if (!readFile(font_file, font_data)) {
+            std::fprintf(stderr, "couldn't read \"%s\"\n", font_file.c_str());
+            result = 1;
+            continue;
+        }
+        for (auto &font_size_pt : options.font_sizes_pt) {
+            if (bake(ft_library, options, font_file, font_data, font_size_pt) != 0) {
+                result = 1;
+            }
+        }
+    }
+    FT_Done_FreeType(ft_library);
+    
+    return result;
+}